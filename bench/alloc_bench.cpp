@@ -0,0 +1,112 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Throughput of `mem::allocate`/`mem::deallocate` against plain `new[]`/`delete[]` from 1 to N threads.
+ * Usage: alloc_bench [max-threads] [ops-per-thread]
+ * 
+ * @file alloc_bench.cpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "../core/mem_utilities.hpp"
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+    using namespace glx;
+
+    constexpr usize kLiveSlots = 256;
+
+    struct PoolBackend {
+        static void* allocate(usize bytes) { return mem::allocate<byte>(bytes); }
+        static void deallocate(void* ptr) { mem::deallocate(ptr); }
+    };
+
+    struct HeapBackend {
+        static void* allocate(usize bytes) { return new byte[bytes]; }
+        static void deallocate(void* ptr) { delete[] reinterpret_cast<byte*>(ptr); }
+    };
+
+    /// Keep `kLiveSlots` blocks alive and replace a pseudo-random one on every step.
+    template <typename Backend>
+    void churn(usize ops, uint32 seed) {
+        void* slots[kLiveSlots] = {};
+        for (usize i = 0; i < ops; i++) {
+            seed = seed * 1664525u + 1013904223u;
+            auto& slot = slots[(seed >> 8) % kLiveSlots];
+            Backend::deallocate(slot);
+            slot = Backend::allocate(16 + (seed >> 20) % 512);
+            *reinterpret_cast<byte*>(slot) = byte(i);
+        }
+        for (auto slot : slots) {
+            Backend::deallocate(slot);
+        }
+    }
+
+    template <typename Backend>
+    double run(usize threads, usize ops) {
+        std::vector<std::thread> workers;
+        auto start = std::chrono::steady_clock::now();
+        for (usize i = 0; i < threads; i++) {
+            workers.emplace_back(churn<Backend>, ops, uint32(i + 1));
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return double(threads * ops) / elapsed.count() / 1e6;
+    }
+}
+
+int main(int argc, char** argv) {
+    usize maxThreads = argc > 1 ? usize(std::atoi(argv[1])) : usize(std::thread::hardware_concurrency());
+    usize ops        = argc > 2 ? usize(std::atoll(argv[2])) : usize(2000000);
+    if (maxThreads == 0) {
+        maxThreads = 1;
+    }
+    // Scaling is throughput per thread against the single-thread row; rows with more busy threads than CPUs
+    // measure time slicing, not contention, and are marked.
+    usize cpus = usize(std::thread::hardware_concurrency());
+    std::printf("%zu hardware threads\n", cpus);
+    std::printf("%8s %16s %16s %8s %14s %14s\n", "threads", "new[] Mops/s", "pool Mops/s", "speedup", "new[] scaling", "pool scaling");
+    double heapBase = 0, poolBase = 0;
+    for (usize threads = 1; ; threads = threads * 2 < maxThreads ? threads * 2 : maxThreads) {
+        auto heap = run<HeapBackend>(threads, ops);
+        auto pool = run<PoolBackend>(threads, ops);
+        if (threads == 1) {
+            heapBase = heap;
+            poolBase = pool;
+        }
+        std::printf("%8zu %16.2f %16.2f %7.2fx %13.0f%% %13.0f%%%s\n", threads, heap, pool, pool / heap,
+            100 * heap / (heapBase * threads), 100 * pool / (poolBase * threads), threads > cpus ? "  oversubscribed" : "");
+        if (threads == maxThreads) {
+            break;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Reassembly of a byte stream arriving in packets into frames, by copying each frame out of a reassembly buffer
+ * with `copy_of_range` against splitting it off a `ByteChain`. Packets and frames have unrelated sizes, so frames
+ * straddle packets; the chain copies every byte once on arrival and never again. Small frames stay in the L1
+ * cache, where a copy is about as cheap as the bookkeeping of views; the chain pulls ahead once frames outgrow it.
+ * Usage: chain_bench [megabytes] [frame bytes]
+ * 
+ * @file chain_bench.cpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "../core/byte_chain.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+    using namespace glx;
+
+    constexpr usize kPacketBytes = 1448;
+
+    usize gSink = 0;
+
+    /// Copy frames out of a flat buffer that packets are appended to, as `Unique<byte[]>` code does today.
+    double copy_seconds(byte const* packet, usize totalBytes, usize frameBytes) {
+        auto start    = std::chrono::steady_clock::now();
+        auto capacity = frameBytes + kPacketBytes;
+        auto pending  = mem::make_unique_array<byte>(capacity);
+        usize used = 0;
+        for (usize arrived = 0; arrived < totalBytes; arrived += kPacketBytes) {
+            mem::copy_of_range(pending.get(), packet, used, 0, kPacketBytes);
+            used += kPacketBytes;
+            while (used >= frameBytes) {
+                auto frame = mem::make_unique_array<byte>(frameBytes);
+                mem::copy_of_range(frame.get(), pending.get(), 0, 0, frameBytes);
+                gSink += usize(frame[0]);
+                if (used > frameBytes) {
+                    mem::copy_of_range(pending.get(), 0, frameBytes, used - frameBytes);
+                }
+                used -= frameBytes;
+            }
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    /// Append packets to a chain and split frames off its front.
+    double chain_seconds(byte const* packet, usize totalBytes, usize frameBytes) {
+        auto start = std::chrono::steady_clock::now();
+        ByteChain pending;
+        ByteChain frame;
+        for (usize arrived = 0; arrived < totalBytes; arrived += kPacketBytes) {
+            pending.append(packet, kPacketBytes);
+            while (pending.size() >= frameBytes) {
+                pending.split_front(frameBytes, frame);
+                gSink += usize(frame.data()[0]);
+            }
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+}
+
+int main(int argc, char** argv) {
+    usize megabytes = argc > 1 ? usize(std::atoll(argv[1])) : usize(256);
+    usize frames[]  = { 1024, 16 * 1024, 256 * 1024, 4 * 1024 * 1024 };
+    if (argc > 2) {
+        frames[0] = usize(std::atoll(argv[2]));
+    }
+    auto  totalBytes = megabytes << 20;
+    byte  packet[kPacketBytes];
+    for (usize i = 0; i < kPacketBytes; i++) {
+        packet[i] = byte(i);
+    }
+    std::printf("%-12s %12s %12s %12s %8s\n", "frame bytes", "stream MB", "copy GB/s", "chain GB/s", "speedup");
+    for (auto frameBytes : frames) {
+        auto copy  = 1e30;
+        auto chain = 1e30;
+        for (int round = 0; round < 3; round++) {
+            auto c = copy_seconds(packet, totalBytes, frameBytes);
+            auto z = chain_seconds(packet, totalBytes, frameBytes);
+            copy  = c < copy ? c : copy;
+            chain = z < chain ? z : chain;
+        }
+        std::printf("%-12zu %12zu %12.2f %12.2f %7.2fx\n", frameBytes, megabytes, double(totalBytes) / copy / 1e9,
+            double(totalBytes) / chain / 1e9, copy / chain);
+        if (argc > 2) {
+            break;
+        }
+    }
+    return int(gSink & 0);
+}
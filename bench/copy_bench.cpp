@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Cached against streaming `copy_of_range`: copy bandwidth, and the cost of re-reading a hot working set
+ * that the copy may have evicted.
+ * Usage: copy_bench [copy-megabytes] [hot-kilobytes]
+ * 
+ * @file copy_bench.cpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "../core/mem_utilities.hpp"
+#include <chrono>
+#include <cstdio>
+
+namespace {
+    using namespace glx;
+
+    double seconds_since(std::chrono::steady_clock::time_point start) {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    uint64 scan(uint64 const* hot, usize count) {
+        uint64 sum = 0;
+        for (usize i = 0; i < count; i += 8) {
+            sum += hot[i];
+        }
+        return sum;
+    }
+}
+
+int main(int argc, char** argv) {
+    usize copyBytes = (argc > 1 ? usize(std::atoll(argv[1])) : usize(256)) << 20;
+    usize hotBytes  = (argc > 2 ? usize(std::atoll(argv[2])) : usize(4096)) << 10;
+    auto  src       = mem::allocate<byte>(copyBytes);
+    auto  dst       = mem::allocate<byte>(copyBytes);
+    auto  hot       = mem::allocate<uint64>(hotBytes / sizeof(uint64));
+    mem::uninitialized_fill_of_range(src, 0, copyBytes, byte(1));
+    mem::uninitialized_fill_of_range(dst, 0, copyBytes, byte(0));
+    mem::uninitialized_fill_of_range(hot, 0, hotBytes / sizeof(uint64), uint64(1));
+    std::printf("llc %zu KB, streaming threshold %zu KB\n", cpu::last_level_cache_bytes() >> 10, mem::streaming_threshold() >> 10);
+    std::printf("%-10s %12s %16s\n", "policy", "copy GB/s", "hot rescan ms");
+    uint64 sink = 0;
+    for (auto policy : { mem::CachedCopy, mem::StreamingCopy }) {
+        double copySeconds = 0, scanSeconds = 0;
+        for (int round = 0; round < 5; round++) {
+            sink += scan(hot, hotBytes / sizeof(uint64));
+            auto start = std::chrono::steady_clock::now();
+            mem::copy_of_range(dst, src, 0, 0, copyBytes, policy);
+            copySeconds += seconds_since(start);
+            start = std::chrono::steady_clock::now();
+            sink += scan(hot, hotBytes / sizeof(uint64));
+            scanSeconds += seconds_since(start);
+        }
+        std::printf("%-10s %12.2f %16.3f\n", policy == mem::CachedCopy ? "cached" : "streaming",
+                    double(copyBytes) * 5 / copySeconds / 1e9, scanSeconds / 5 * 1e3);
+    }
+    mem::deallocate(src);
+    mem::deallocate(dst);
+    mem::deallocate(hot);
+    return sink == 0;
+}
@@ -0,0 +1,81 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Bandwidth of `mem::fill_of_range` against `std::fill` for 1 to 16 byte element types.
+ * Usage: fill_bench [megabytes] ; set GLX_SIMD=scalar|sse2|avx2 to cap the kernel.
+ * 
+ * @file fill_bench.cpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "../core/mem_utilities.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace {
+    using namespace glx;
+
+    struct Pair64 {
+        uint64 lo, hi;
+    };
+
+    template <typename F>
+    double gigabytes_per_second(usize bytes, F&& fill) {
+        fill();
+        auto rounds = usize(8);
+        auto start  = std::chrono::steady_clock::now();
+        for (usize i = 0; i < rounds; i++) {
+            fill();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return double(bytes * rounds) / elapsed.count() / 1e9;
+    }
+
+    template <typename T>
+    void run(char const* name, usize bytes, T const& value) {
+        auto count = bytes / sizeof(T);
+        auto arr   = mem::allocate<T>(count);
+        auto stl   = gigabytes_per_second(bytes, [&] { std::fill(arr, arr + count, value); });
+        auto glx   = gigabytes_per_second(bytes, [&] { mem::fill_of_range(arr, 0, count, value); });
+        std::printf("%-10s %14.2f %14.2f %8.2fx\n", name, stl, glx, glx / stl);
+        mem::deallocate(arr);
+    }
+}
+
+int main(int argc, char** argv) {
+    usize megabytes = argc > 1 ? usize(std::atoll(argv[1])) : usize(64);
+    usize bytes     = megabytes << 20;
+    std::printf("simd level %d, %zu MB\n", int(cpu::simd_level()), megabytes);
+    std::printf("%-10s %14s %14s %9s\n", "type", "std GB/s", "mem GB/s", "speedup");
+    run<uint8>("uint8", bytes, uint8(0x5a));
+    run<uint16>("uint16", bytes, uint16(0x1234));
+    run<float>("float", bytes, 1.5f);
+    run<uint64>("uint64", bytes, uint64(0x0123456789abcdefull));
+    run<Pair64>("pair64", bytes, Pair64{1, 2});
+    run<float>("zero", bytes, 0.0f);
+    return 0;
+}
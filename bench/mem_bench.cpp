@@ -0,0 +1,311 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Microbenchmarks of every `mem` primitive against the matching `std` algorithm, over trivial and non-trivial
+ * element types, sizes from 8 B to 1 GB and disjoint against overlapping ranges. Results are printed as JSON.
+ * Usage: mem_bench [--min-bytes N] [--max-bytes N] [--filter NAME] [--out FILE]
+ * 
+ * @file mem_bench.cpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "../core/object.hpp"
+#include "../core/mem_parallel.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    using namespace glx;
+
+    ///
+    /// Harness.
+    ///
+    struct Options {
+        usize       minBytes = 8;
+        usize       maxBytes = usize(1) << 30;
+        char const* filter   = nullptr;
+        char const* out      = nullptr;
+    };
+
+    struct Result {
+        std::string function;
+        std::string type;
+        std::string layout;
+        usize       bytes;
+        double      glxNs;
+        double      stdNs;
+    };
+
+    Options             options;
+    std::vector<Result> results;
+    uint64              sink = 0;
+
+    /// Run `op` in geometrically growing batches until 20 ms have passed, return nanoseconds per call.
+    template <typename F>
+    double nanoseconds_per_call(F&& op) {
+        using Clock = std::chrono::steady_clock;
+        op();
+        usize calls = 0;
+        usize batch = 1;
+        auto  start = Clock::now();
+        std::chrono::duration<double, std::nano> elapsed(0);
+        while (elapsed.count() < 20e6) {
+            for (usize i = 0; i < batch; i++) {
+                op();
+            }
+            calls  += batch;
+            batch  *= 2;
+            elapsed = Clock::now() - start;
+        }
+        return elapsed.count() / double(calls);
+    }
+
+    bool selected(char const* function) {
+        return options.filter == nullptr || std::strstr(function, options.filter) != nullptr;
+    }
+
+    template <typename G, typename S>
+    void measure(char const* function, char const* type, char const* layout, usize bytes, G&& glxOp, S&& stdOp) {
+        auto glxNs = nanoseconds_per_call(glxOp);
+        auto stdNs = nanoseconds_per_call(stdOp);
+        results.push_back(Result{ function, type, layout, bytes, glxNs, stdNs });
+        std::fprintf(stderr, "%-28s %-10s %-11s %12zu B %14.1f ns %14.1f ns\n", function, type, layout, bytes, glxNs, stdNs);
+    }
+
+    void write_json(FILE* file) {
+        std::fprintf(file, "{\n  \"simd_level\": %d,\n  \"threads\": %zu,\n  \"results\": [\n",
+                     int(cpu::simd_level()), ThreadPool::global().concurrency());
+        for (usize i = 0; i < results.size(); i++) {
+            auto& r = results[i];
+            std::fprintf(file, "    {\"function\": \"%s\", \"type\": \"%s\", \"layout\": \"%s\", \"bytes\": %zu, "
+                               "\"glx_ns\": %.3f, \"std_ns\": %.3f, \"speedup\": %.4f}%s\n",
+                         r.function.c_str(), r.type.c_str(), r.layout.c_str(), r.bytes, r.glxNs, r.stdNs,
+                         r.stdNs / r.glxNs, i + 1 < results.size() ? "," : "");
+        }
+        std::fprintf(file, "  ]\n}\n");
+    }
+
+    ///
+    /// Element types.
+    ///
+    struct Text {
+        std::string value;
+        Text() = default;
+        explicit Text(char const* str) : value(str) {}
+    };
+
+    template <typename T> struct TypeName;
+    template <> struct TypeName<uint64> { static char const* get() { return "trivial"; } };
+    template <> struct TypeName<Text>   { static char const* get() { return "nontrivial"; } };
+
+    template <typename T> T sample_value();
+    template <> uint64 sample_value<uint64>() { return 0x0123456789abcdefull; }
+    template <> Text   sample_value<Text>()   { return Text("a short string"); }
+
+    template <typename T>
+    void destroy(T* arr, usize count) {
+        for (usize i = 0; i < count; i++) {
+            arr[i].~T();
+        }
+    }
+
+    ///
+    /// Range primitives.
+    ///
+    template <typename T>
+    void bench_ranges(usize bytes) {
+        auto type   = TypeName<T>::get();
+        auto count  = std::max<usize>(1, bytes / sizeof(T));
+        auto shift  = std::max<usize>(1, count / 8);
+        auto size   = count * sizeof(T);
+        auto value  = sample_value<T>();
+        auto src    = mem::allocate<T>(count + shift);
+        auto dst    = mem::allocate<T>(count + shift);
+        auto raw    = mem::allocate<T>(count);
+        std::uninitialized_fill(src, src + count + shift, value);
+        std::uninitialized_fill(dst, dst + count + shift, value);
+
+        if (selected("fill_of_range")) {
+            measure("fill_of_range", type, "disjoint", size,
+                    [&] { mem::fill_of_range(dst, 0, count, value); },
+                    [&] { std::fill(dst, dst + count, value); });
+        }
+        if (selected("uninitialized_fill_of_range")) {
+            measure("uninitialized_fill_of_range", type, "disjoint", size,
+                    [&] { mem::uninitialized_fill_of_range(raw, 0, count, value); destroy(raw, count); },
+                    [&] { std::uninitialized_fill(raw, raw + count, value); destroy(raw, count); });
+        }
+        if (selected("copy_of_range")) {
+            measure("copy_of_range", type, "disjoint", size,
+                    [&] { mem::copy_of_range(dst, src, 0, 0, count); },
+                    [&] { std::copy(src, src + count, dst); });
+            measure("copy_of_range", type, "overlapping", size,
+                    [&] { mem::copy_of_range(src, shift, 0, count); },
+                    [&] { std::copy_backward(src, src + count, src + count + shift); });
+        }
+        if (selected("uninitialized_copy_of_range")) {
+            measure("uninitialized_copy_of_range", type, "disjoint", size,
+                    [&] { mem::uninitialized_copy_of_range(raw, src, 0, 0, count); destroy(raw, count); },
+                    [&] { std::uninitialized_copy(src, src + count, raw); destroy(raw, count); });
+        }
+        if (selected("move_of_range")) {
+            measure("move_of_range", type, "disjoint", size,
+                    [&] { mem::move_of_range(dst, src, 0, 0, count); },
+                    [&] { std::move(src, src + count, dst); });
+            measure("move_of_range", type, "overlapping", size,
+                    [&] { mem::move_of_range(src, shift, 0, count); },
+                    [&] { std::move_backward(src, src + count, src + count + shift); });
+        }
+        if (selected("uninitialized_move_of_range")) {
+            measure("uninitialized_move_of_range", type, "disjoint", size,
+                    [&] { mem::uninitialized_move_of_range(raw, src, 0, 0, count); destroy(raw, count); },
+                    [&] { std::uninitialized_copy(std::make_move_iterator(src), std::make_move_iterator(src + count), raw); destroy(raw, count); });
+        }
+        if (selected("relocate_of_range")) {
+            std::uninitialized_fill(raw, raw + count, value);
+            measure("relocate_of_range", type, "disjoint", size,
+                    [&] { mem::relocate_of_range(dst, raw, 0, 0, count); mem::relocate_of_range(raw, dst, 0, 0, count); },
+                    [&] {
+                        std::uninitialized_copy(std::make_move_iterator(raw), std::make_move_iterator(raw + count), dst);
+                        destroy(raw, count);
+                        std::uninitialized_copy(std::make_move_iterator(dst), std::make_move_iterator(dst + count), raw);
+                        destroy(dst, count);
+                    });
+            destroy(raw, count);
+            std::uninitialized_fill(dst, dst + count, value);
+        }
+        if (selected("destruct_of_range")) {
+            measure("destruct_of_range", type, "disjoint", size,
+                    [&] { std::uninitialized_fill(raw, raw + count, value); mem::destruct_of_range(raw, 0, count); },
+                    [&] { std::uninitialized_fill(raw, raw + count, value); destroy(raw, count); });
+        }
+        if (selected("par::copy_of_range") && size >= mem::par::kParallelMinBytes) {
+            measure("par::copy_of_range", type, "disjoint", size,
+                    [&] { mem::par::copy_of_range(dst, src, 0, 0, count); },
+                    [&] { std::copy(src, src + count, dst); });
+        }
+        if (selected("par::fill_of_range") && size >= mem::par::kParallelMinBytes) {
+            measure("par::fill_of_range", type, "disjoint", size,
+                    [&] { mem::par::fill_of_range(dst, 0, count, value); },
+                    [&] { std::fill(dst, dst + count, value); });
+        }
+
+        destroy(src, count + shift);
+        destroy(dst, count + shift);
+        mem::deallocate(src);
+        mem::deallocate(dst);
+        mem::deallocate(raw);
+    }
+
+    ///
+    /// Allocation primitives.
+    ///
+    void bench_allocate(usize bytes) {
+        if (selected("allocate")) {
+            measure("allocate", "byte", "disjoint", bytes,
+                    [&] { auto p = mem::allocate<byte>(bytes); p[0] = 1; sink += p[0]; mem::deallocate(p); },
+                    [&] { auto p = new byte[bytes]; p[0] = 1; sink += p[0]; delete[] p; });
+        }
+    }
+
+    template <usize N>
+    struct PlainPayload {
+        byte data[N];
+    };
+
+    template <usize N>
+    struct ObjectPayload : Object {
+        byte data[N];
+    };
+
+    template <usize N>
+    void bench_objects() {
+        if (selected("make_unique")) {
+            measure("make_unique", "trivial", "disjoint", N,
+                    [&] { auto u = mem::make_unique<PlainPayload<N>>(); u->data[0] = 1; sink += u->data[0]; },
+                    [&] { auto u = std::make_unique<PlainPayload<N>>(); u->data[0] = 1; sink += u->data[0]; });
+        }
+        if (selected("Object::operator new")) {
+            measure("Object::operator new", "object", "disjoint", N,
+                    [&] { auto o = new ObjectPayload<N>(); o->data[0] = 1; sink += o->data[0]; delete o; },
+                    [&] { auto o = new PlainPayload<N>(); o->data[0] = 1; sink += o->data[0]; delete o; });
+        }
+    }
+
+    bool parse(int argc, char** argv) {
+        for (int i = 1; i < argc; i++) {
+            auto more = i + 1 < argc;
+            if (std::strcmp(argv[i], "--min-bytes") == 0 && more) {
+                options.minBytes = usize(std::strtoull(argv[++i], nullptr, 10));
+            } else if (std::strcmp(argv[i], "--max-bytes") == 0 && more) {
+                options.maxBytes = usize(std::strtoull(argv[++i], nullptr, 10));
+            } else if (std::strcmp(argv[i], "--filter") == 0 && more) {
+                options.filter = argv[++i];
+            } else if (std::strcmp(argv[i], "--out") == 0 && more) {
+                options.out = argv[++i];
+            } else {
+                std::fprintf(stderr, "usage: %s [--min-bytes N] [--max-bytes N] [--filter NAME] [--out FILE]\n", argv[0]);
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (!parse(argc, argv)) {
+        return 1;
+    }
+    for (usize bytes = 8; bytes <= options.maxBytes; bytes *= 8) {
+        if (bytes < options.minBytes) {
+            continue;
+        }
+        bench_allocate(bytes);
+        bench_ranges<uint64>(bytes);
+        bench_ranges<Text>(bytes);
+    }
+    bench_objects<8>();
+    bench_objects<64>();
+    bench_objects<512>();
+    bench_objects<4096>();
+
+    auto file = options.out != nullptr ? std::fopen(options.out, "w") : stdout;
+    if (file == nullptr) {
+        std::perror(options.out);
+        return 1;
+    }
+    write_json(file);
+    if (file != stdout) {
+        std::fclose(file);
+    }
+    return sink == 42;
+}
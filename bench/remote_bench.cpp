@@ -0,0 +1,135 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Throughput of `mem::allocate` against plain `new[]` when every block is freed on another thread: 1 to N pairs of 
+ * a producer that allocates and a consumer that frees, connected by a ring.
+ * Usage: remote_bench [max-pairs] [blocks-per-producer]
+ * 
+ * @file remote_bench.cpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "../core/mem_utilities.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+    using namespace glx;
+
+    constexpr usize kRingSlots = 1024;
+
+    struct PoolBackend {
+        static void* allocate(usize bytes) { return mem::allocate<byte>(bytes); }
+        static void deallocate(void* ptr) { mem::deallocate(ptr); }
+    };
+
+    struct HeapBackend {
+        static void* allocate(usize bytes) { return new byte[bytes]; }
+        static void deallocate(void* ptr) { delete[] reinterpret_cast<byte*>(ptr); }
+    };
+
+    /// A single-producer single-consumer ring of blocks.
+    struct Ring {
+        alignas(mem::kCacheLineBytes) std::atomic<usize> head{ 0 };
+        alignas(mem::kCacheLineBytes) std::atomic<usize> tail{ 0 };
+        alignas(mem::kCacheLineBytes) void* slots[kRingSlots];
+    };
+
+    template <typename Backend>
+    void produce(Ring& ring, usize blocks) {
+        uint32 seed = 1;
+        for (usize i = 0; i < blocks; i++) {
+            seed = seed * 1664525u + 1013904223u;
+            auto block = Backend::allocate(16 + (seed >> 20) % 256);
+            *reinterpret_cast<byte*>(block) = byte(i);
+            auto tail = ring.tail.load(std::memory_order_relaxed);
+            while (tail - ring.head.load(std::memory_order_acquire) == kRingSlots) {
+                std::this_thread::yield();
+            }
+            ring.slots[tail % kRingSlots] = block;
+            ring.tail.store(tail + 1, std::memory_order_release);
+        }
+    }
+
+    template <typename Backend>
+    void consume(Ring& ring, usize blocks) {
+        for (usize i = 0; i < blocks; i++) {
+            auto head = ring.head.load(std::memory_order_relaxed);
+            while (ring.tail.load(std::memory_order_acquire) == head) {
+                std::this_thread::yield();
+            }
+            Backend::deallocate(ring.slots[head % kRingSlots]);
+            ring.head.store(head + 1, std::memory_order_release);
+        }
+    }
+
+    template <typename Backend>
+    double run(usize pairs, usize blocks) {
+        std::vector<Ring> rings(pairs);
+        std::vector<std::thread> workers;
+        auto start = std::chrono::steady_clock::now();
+        for (usize i = 0; i < pairs; i++) {
+            workers.emplace_back(produce<Backend>, std::ref(rings[i]), blocks);
+            workers.emplace_back(consume<Backend>, std::ref(rings[i]), blocks);
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return double(pairs * blocks) / elapsed.count() / 1e6;
+    }
+}
+
+int main(int argc, char** argv) {
+    usize maxPairs = argc > 1 ? usize(std::atoi(argv[1])) : usize(std::thread::hardware_concurrency() / 2);
+    usize blocks   = argc > 2 ? usize(std::atoll(argv[2])) : usize(2000000);
+    if (maxPairs == 0) {
+        maxPairs = 1;
+    }
+    // Scaling is throughput per pair against the single-pair row; rows with more busy threads than CPUs
+    // measure time slicing, not contention, and are marked.
+    usize cpus = usize(std::thread::hardware_concurrency());
+    std::printf("%zu hardware threads\n", cpus);
+    std::printf("%8s %16s %16s %8s %14s %14s\n", "pairs", "new[] Mops/s", "pool Mops/s", "speedup", "new[] scaling", "pool scaling");
+    double heapBase = 0, poolBase = 0;
+    for (usize pairs = 1; ; pairs = pairs * 2 < maxPairs ? pairs * 2 : maxPairs) {
+        auto heap = run<HeapBackend>(pairs, blocks);
+        auto pool = run<PoolBackend>(pairs, blocks);
+        if (pairs == 1) {
+            heapBase = heap;
+            poolBase = pool;
+        }
+        std::printf("%8zu %16.2f %16.2f %7.2fx %13.0f%% %13.0f%%%s\n", pairs, heap, pool, pool / heap,
+            100 * heap / (heapBase * pairs), 100 * pool / (poolBase * pairs), pairs * 2 > cpus ? "  oversubscribed" : "");
+        if (pairs == maxPairs) {
+            break;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,198 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Throughput and round-trip latency of `SpscRing` and `MpmcRing` against a `std::mutex` guarding a `std::deque`.
+ * Throughput moves 16-byte records from producers to consumers in batches of 1 and 32; latency bounces one record
+ * between two threads over a pair of queues and reports percentiles of the round trip.
+ * Usage: ring_bench [records]
+ * 
+ * @file ring_bench.cpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "../core/ring_buffer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+    using namespace glx;
+
+    constexpr usize kCapacity   = 1024;
+    constexpr usize kMaxBatch   = 32;
+    constexpr usize kRoundTrips = 20000;
+
+    struct Record {
+        uint64 sequence;
+        uint64 payload;
+    };
+
+    /// The baseline: a bounded deque behind one mutex, with the same interface as the rings.
+    class LockedQueue {
+        std::mutex         _lock;
+        std::deque<Record> _records;
+
+    public:
+        explicit LockedQueue(usize) {}
+
+        usize push_n(Record const* src, usize count) {
+            std::lock_guard<std::mutex> guard(_lock);
+            auto room = kCapacity - _records.size();
+            count = count < room ? count : room;
+            _records.insert(_records.end(), src, src + count);
+            return count;
+        }
+
+        usize pop_n(Record* dst, usize count) {
+            std::lock_guard<std::mutex> guard(_lock);
+            count = count < _records.size() ? count : _records.size();
+            std::copy(_records.begin(), _records.begin() + count, dst);
+            _records.erase(_records.begin(), _records.begin() + count);
+            return count;
+        }
+    };
+
+    template <typename Q>
+    void push_all(Q& queue, Record const* src, usize count) {
+        while (count > 0) {
+            auto pushed = queue.push_n(src, count);
+            if (pushed == 0) {
+                std::this_thread::yield();
+            }
+            src   += pushed;
+            count -= pushed;
+        }
+    }
+
+    template <typename Q>
+    usize pop_some(Q& queue, Record* dst, usize count) {
+        while (true) {
+            auto popped = queue.pop_n(dst, count);
+            if (popped > 0) {
+                return popped;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    /// Millions of records per second moved by `producers` threads to `consumers` threads in batches of `batch`.
+    template <typename Q>
+    double throughput(usize records, usize batch, usize producers, usize consumers) {
+        Q queue(kCapacity);
+        auto perProducer = records / producers;
+        std::atomic<usize> remaining(perProducer * producers);
+        std::vector<std::thread> threads;
+        auto start = std::chrono::steady_clock::now();
+        for (usize p = 0; p < producers; p++) {
+            threads.emplace_back([&] {
+                Record run[kMaxBatch];
+                for (usize i = 0; i < perProducer; i += batch) {
+                    for (usize k = 0; k < batch; k++) {
+                        run[k] = Record{i + k, k};
+                    }
+                    push_all(queue, run, batch < perProducer - i ? batch : perProducer - i);
+                }
+            });
+        }
+        for (usize c = 0; c < consumers; c++) {
+            threads.emplace_back([&] {
+                Record run[kMaxBatch];
+                while (remaining.load(std::memory_order_relaxed) > 0) {
+                    auto popped = queue.pop_n(run, batch);
+                    if (popped == 0) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    remaining.fetch_sub(popped, std::memory_order_relaxed);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return double(perProducer * producers) / elapsed.count() / 1e6;
+    }
+
+    /// Round trips of one record through `ping` and back through `pong`, in nanoseconds, sorted.
+    template <typename Q>
+    std::vector<double> round_trips() {
+        Q ping(kCapacity);
+        Q pong(kCapacity);
+        std::thread echo([&] {
+            Record record;
+            for (usize i = 0; i < kRoundTrips; i++) {
+                pop_some(ping, &record, 1);
+                push_all(pong, &record, 1);
+            }
+        });
+        std::vector<double> samples;
+        samples.reserve(kRoundTrips);
+        for (usize i = 0; i < kRoundTrips; i++) {
+            Record record{i, 0};
+            auto start = std::chrono::steady_clock::now();
+            push_all(ping, &record, 1);
+            pop_some(pong, &record, 1);
+            std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+            samples.push_back(elapsed.count());
+        }
+        echo.join();
+        std::sort(samples.begin(), samples.end());
+        return samples;
+    }
+
+    template <typename Q>
+    void report(char const* name, usize records) {
+        auto single  = throughput<Q>(records, 1, 1, 1);
+        auto batched = throughput<Q>(records, kMaxBatch, 1, 1);
+        auto shared  = throughput<Q>(records, kMaxBatch, 2, 2);
+        auto trips   = round_trips<Q>();
+        std::printf("%-8s %12.2f %12.2f %12.2f %10.0f %10.0f %10.0f\n", name, single, batched, shared,
+            trips[trips.size() / 2], trips[trips.size() * 99 / 100], trips.back());
+    }
+}
+
+int main(int argc, char** argv) {
+    usize records = argc > 1 ? usize(std::atoll(argv[1])) : usize(1) << 22;
+    std::printf("%-8s %12s %12s %12s %10s %10s %10s\n", "queue", "1:1 x1 Mr/s", "1:1 x32 Mr/s", "2:2 x32 Mr/s", "rtt p50", "rtt p99", "rtt max");
+    report<LockedQueue>("mutex", records);
+    /// `SpscRing` has one producer and one consumer only, so it sits out the shared run.
+    {
+        auto single  = throughput<SpscRing<Record>>(records, 1, 1, 1);
+        auto batched = throughput<SpscRing<Record>>(records, kMaxBatch, 1, 1);
+        auto trips   = round_trips<SpscRing<Record>>();
+        std::printf("%-8s %12.2f %12.2f %12s %10.0f %10.0f %10.0f\n", "spsc", single, batched, "-",
+            trips[trips.size() / 2], trips[trips.size() * 99 / 100], trips.back());
+    }
+    report<MpmcRing<Record>>("mpmc", records);
+    return 0;
+}
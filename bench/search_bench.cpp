@@ -0,0 +1,101 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Scan bandwidth of `mem::find_of_range`, `count_of_range` and `equal_of_range` against `std::find`, `std::count`
+ * and `std::equal` for 1 to 8 byte keys, with `memchr` and `memcmp` as the reference for bytes.
+ * Every scan runs over the whole range: the key is absent and the compared ranges are equal.
+ * Usage: search_bench [kilobytes] ; set GLX_SIMD=scalar|sse2|avx2 to cap the kernel.
+ * 
+ * @file search_bench.cpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "../core/mem_utilities.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+    using namespace glx;
+
+    volatile usize gSink;
+
+    template <typename F>
+    double gigabytes_per_second(usize bytes, F&& scan) {
+        gSink = scan();
+        auto rounds = usize(1);
+        while (true) {
+            auto start = std::chrono::steady_clock::now();
+            for (usize i = 0; i < rounds; i++) {
+                gSink = scan();
+            }
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed.count() > 0.1) {
+                return double(bytes * rounds) / elapsed.count() / 1e9;
+            }
+            rounds *= 2;
+        }
+    }
+
+    template <typename T>
+    void run(char const* name, usize bytes) {
+        auto count = bytes / sizeof(T);
+        auto lhs   = mem::allocate<T>(count);
+        auto rhs   = mem::allocate<T>(count);
+        for (usize i = 0; i < count; i++) {
+            lhs[i] = T(i % 100 + 1);
+        }
+        mem::copy_of_range(rhs, lhs, 0, 0, count);
+        auto key = T(0);
+        auto stdFind  = gigabytes_per_second(bytes, [&] { return usize(std::find(lhs, lhs + count, key) - lhs); });
+        auto memFind  = gigabytes_per_second(bytes, [&] { usize at = 0; mem::find_of_range(lhs, 0, count, key, at); return at; });
+        auto stdCount = gigabytes_per_second(bytes, [&] { return usize(std::count(lhs, lhs + count, key)); });
+        auto memCount = gigabytes_per_second(bytes, [&] { usize n = 0; mem::count_of_range(lhs, 0, count, key, n); return n; });
+        auto stdEqual = gigabytes_per_second(bytes, [&] { return usize(std::equal(lhs, lhs + count, rhs)); });
+        auto memEqual = gigabytes_per_second(bytes, [&] { bool eq = false; mem::equal_of_range(lhs, rhs, 0, 0, count, eq); return usize(eq); });
+        std::printf("%-8s %8.2f %8.2f %8.2f %8.2f %8.2f %8.2f\n", name, stdFind, memFind, stdCount, memCount, stdEqual, memEqual);
+        if (sizeof(T) == 1) {
+            auto libcFind  = gigabytes_per_second(bytes, [&] { return usize(std::memchr(lhs, 0, bytes) != nullptr); });
+            auto libcEqual = gigabytes_per_second(bytes, [&] { return usize(std::memcmp(lhs, rhs, bytes) == 0); });
+            std::printf("%-8s %8s %8.2f %8s %8s %8s %8.2f\n", "libc", "", libcFind, "", "", "", libcEqual);
+        }
+        mem::deallocate(lhs);
+        mem::deallocate(rhs);
+    }
+}
+
+int main(int argc, char** argv) {
+    usize kilobytes = argc > 1 ? usize(std::atoll(argv[1])) : usize(256);
+    usize bytes     = kilobytes << 10;
+    std::printf("simd level %d, %zu KB, GB/s\n", int(cpu::simd_level()), kilobytes);
+    std::printf("%-8s %8s %8s %8s %8s %8s %8s\n", "type", "std find", "mem find", "std cnt", "mem cnt", "std eq", "mem eq");
+    run<uint8>("uint8", bytes);
+    run<uint16>("uint16", bytes);
+    run<uint32>("uint32", bytes);
+    run<uint64>("uint64", bytes);
+    return 0;
+}
@@ -0,0 +1,124 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Copy/destroy throughput of `mem::Shared` against `std::shared_ptr` from 1 to N threads that all copy the same
+ * pointer, so the atomic count is contended; the thread-local `LocalShared` runs alongside as the floor.
+ * Usage: shared_bench [max-threads] [ops-per-thread]
+ * 
+ * @file shared_bench.cpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "../core/mem_shared.hpp"
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+    using namespace glx;
+
+    struct Payload {
+        uint64 value = 1;
+    };
+
+    struct Node : mem::RefCounted {
+        uint64 value = 1;
+    };
+
+    struct LocalNode : mem::LocalRefCounted {
+        uint64 value = 1;
+    };
+
+    /// Copy `source` into a small ring of slots, dropping the previous copy every step. Both pointers skip the
+    /// count when assigned the object they already hold, so the slot is emptied first.
+    template <typename Ptr>
+    uint64 churn(Ptr const& source, usize ops) {
+        Ptr    slots[8];
+        uint64 sum = 0;
+        for (usize i = 0; i < ops; i++) {
+            auto& slot = slots[i & 7];
+            slot.reset();
+            slot = source;
+            sum += slot->value;
+        }
+        return sum;
+    }
+
+    /// Every thread copies the one pointer created by `make`; returns millions of copy+destroy per second.
+    template <typename Make>
+    double run(usize threads, usize ops, Make make) {
+        auto source = make();
+        std::vector<std::thread> workers;
+        std::vector<uint64> sums(threads);
+        auto start = std::chrono::steady_clock::now();
+        for (usize i = 0; i < threads; i++) {
+            workers.emplace_back([&, i]() { sums[i] = churn(source, ops); });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return double(threads * ops) / elapsed.count() / 1e6;
+    }
+
+    /// Thread-local counts can't be shared, so every thread copies its own pointer.
+    template <typename Make>
+    double run_local(usize threads, usize ops, Make make) {
+        std::vector<std::thread> workers;
+        std::vector<uint64> sums(threads);
+        auto start = std::chrono::steady_clock::now();
+        for (usize i = 0; i < threads; i++) {
+            workers.emplace_back([&, i]() { sums[i] = churn(make(), ops); });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return double(threads * ops) / elapsed.count() / 1e6;
+    }
+}
+
+int main(int argc, char** argv) {
+    usize maxThreads = argc > 1 ? usize(std::atoi(argv[1])) : usize(std::thread::hardware_concurrency());
+    usize ops        = argc > 2 ? usize(std::atoll(argv[2])) : usize(10000000);
+    if (maxThreads == 0) {
+        maxThreads = 1;
+    }
+    std::printf("%8s %16s %16s %16s %16s\n", "threads", "std Mops/s", "boxed Mops/s", "intrusive Mops/s", "local Mops/s");
+    for (usize threads = 1; ; threads = threads * 2 < maxThreads ? threads * 2 : maxThreads) {
+        auto std      = run(threads, ops, []() { return std::make_shared<Payload>(); });
+        auto boxed    = run(threads, ops, []() { return mem::make_shared<Payload>(); });
+        auto intruded = run(threads, ops, []() { return mem::make_shared<Node>(); });
+        auto local    = run_local(threads, ops, []() { return mem::make_local_shared<LocalNode>(); });
+        std::printf("%8zu %16.2f %16.2f %16.2f %16.2f\n", threads, std, boxed, intruded, local);
+        if (threads == maxThreads) {
+            break;
+        }
+    }
+    return 0;
+}
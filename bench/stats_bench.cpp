@@ -0,0 +1,146 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/**
+ * Cost of allocation statistics on the `mem::allocate`/`mem::deallocate` hot path. The same source is built 
+ * twice, as `stats_bench` and as `stats_bench_nostats` with `GLX_MEM_STATS=0`; give the second one to the first
+ * to print the overhead. Two workloads are timed: `churn` only allocates and frees, the worst case for any
+ * per-allocation cost, and `touch` also writes every block, closer to what a real caller does.
+ * Usage: stats_bench [--ops N] [--rounds N] [--baseline path-to-stats_bench_nostats]
+ * 
+ * @file stats_bench.cpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "../core/mem_utilities.hpp"
+#include "../core/mem_stats.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+    using namespace glx;
+
+    constexpr usize kLiveSlots      = 256;
+    constexpr usize kBaselinePasses = 9;
+
+    /// Keep `kLiveSlots` blocks alive and replace a pseudo-random one on every step, returns ns per step.
+    template <bool Touch>
+    double churn(usize ops, uint32 seed) {
+        void* slots[kLiveSlots] = {};
+        auto start = std::chrono::steady_clock::now();
+        for (usize i = 0; i < ops; i++) {
+            seed = seed * 1664525u + 1013904223u;
+            auto& slot  = slots[(seed >> 8) % kLiveSlots];
+            auto  bytes = 16 + (seed >> 20) % 512;
+            mem::deallocate(slot);
+            slot = mem::allocate<byte>(bytes);
+            std::memset(slot, int(i), Touch ? bytes : 1);
+        }
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        for (auto slot : slots) {
+            mem::deallocate(slot);
+        }
+        return elapsed.count() / double(ops);
+    }
+
+    /// The best of `rounds` runs, which filters out most scheduling noise.
+    template <bool Touch>
+    double best_of(usize rounds, usize ops) {
+        double best = 0;
+        for (usize round = 0; round < rounds; round++) {
+            auto ns = churn<Touch>(ops, uint32(round + 1));
+            if (round == 0 || ns < best) {
+                best = ns;
+            }
+        }
+        return best;
+    }
+
+    /// Run a build of this benchmark as a child process and read its ns/op for both workloads.
+    bool run_child(const std::string& command, double& churnNs, double& touchNs) {
+        auto pipe = ::popen(command.c_str(), "r");
+        if (pipe == nullptr) {
+            return false;
+        }
+        auto parsed = std::fscanf(pipe, "%*s %lf %*s %lf", &churnNs, &touchNs) == 2;
+        return ::pclose(pipe) == 0 && parsed;
+    }
+}
+
+int main(int argc, char** argv) {
+    usize       ops    = 300000;
+    usize       rounds = 30;
+    std::string baseline;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--ops") == 0) {
+            ops = usize(std::atoll(argv[i + 1]));
+        } else if (std::strcmp(argv[i], "--rounds") == 0) {
+            rounds = usize(std::atoll(argv[i + 1]));
+        } else if (std::strcmp(argv[i], "--baseline") == 0) {
+            baseline = argv[i + 1];
+        }
+    }
+    if (ops == 0 || rounds == 0) {
+        std::fprintf(stderr, "stats_bench: --ops and --rounds must be positive\n");
+        return 1;
+    }
+    if (baseline.empty()) {
+        auto churnNs = best_of<false>(rounds, ops);
+        auto touchNs = best_of<true>(rounds, ops);
+        std::printf("churn-ns/op %.3f\ntouch-ns/op %.3f\n", churnNs, touchNs);
+        return 0;
+    }
+    // Run both binaries as child processes, alternating, so that each sees the same machine noise and gets as
+    // many different heap and stack layouts; a single process can be a few percent off from layout alone.
+    double churnNs     = 0;
+    double touchNs     = 0;
+    double baseChurnNs = 0;
+    double baseTouchNs = 0;
+    auto arguments = " --ops " + std::to_string(ops) + " --rounds " + std::to_string(rounds);
+    for (usize pass = 0; pass < kBaselinePasses; pass++) {
+        double passChurnNs;
+        double passTouchNs;
+        if (!run_child(baseline + arguments, passChurnNs, passTouchNs) || passChurnNs <= 0 || passTouchNs <= 0) {
+            std::fprintf(stderr, "stats_bench: could not run baseline '%s'\n", baseline.c_str());
+            return 1;
+        }
+        baseChurnNs = pass == 0 || passChurnNs < baseChurnNs ? passChurnNs : baseChurnNs;
+        baseTouchNs = pass == 0 || passTouchNs < baseTouchNs ? passTouchNs : baseTouchNs;
+        if (!run_child(std::string(argv[0]) + arguments, passChurnNs, passTouchNs) || passChurnNs <= 0 || passTouchNs <= 0) {
+            std::fprintf(stderr, "stats_bench: could not run '%s'\n", argv[0]);
+            return 1;
+        }
+        churnNs = pass == 0 || passChurnNs < churnNs ? passChurnNs : churnNs;
+        touchNs = pass == 0 || passTouchNs < touchNs ? passTouchNs : touchNs;
+    }
+    std::printf("%-8s %14s %14s %10s\n", "workload", "stats ns/op", "no-stats ns/op", "overhead");
+    std::printf("%-8s %14.3f %14.3f %9.2f%%\n", "churn", churnNs, baseChurnNs, (churnNs - baseChurnNs) / baseChurnNs * 100.0);
+    std::printf("%-8s %14.3f %14.3f %9.2f%%\n", "touch", touchNs, baseTouchNs, (touchNs - baseTouchNs) / baseTouchNs * 100.0);
+    return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Throughput of `glx::Vector` against `std::vector` for `push_back` without a `reserve`, for `insert` in the middle
+ * and for appending short runs. `uint64` shows the cost of growth and of opening gaps for plain data; `mem::Unique`
+ * is trivially relocatable but not trivially copyable, which `std::vector` has to move one element at a time.
+ * Usage: vector_bench [elements]
+ * 
+ * @file vector_bench.cpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "../core/vector.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+    using namespace glx;
+
+    constexpr usize kRunLength = 16;
+
+    usize gSink = 0;
+
+    /// Millions of elements per second of `body`, best of five runs over `count` elements.
+    template <typename F>
+    double mops(usize count, F&& body) {
+        auto best = 1e30;
+        for (int i = 0; i < 5; i++) {
+            auto start = std::chrono::steady_clock::now();
+            gSink += body();
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            best = elapsed.count() < best ? elapsed.count() : best;
+        }
+        return double(count) / best / 1e6;
+    }
+
+    template <typename T>
+    T make(usize) { return T(); }
+
+    template <>
+    uint64 make<uint64>(usize i) { return uint64(i); }
+
+    void report(char const* type, char const* operation, usize count, double stdMops, double glxMops) {
+        std::printf("%-8s %-10s %10zu %12.2f %12.2f %7.2fx\n", type, operation, count, stdMops, glxMops, glxMops / stdMops);
+    }
+
+    template <typename T>
+    void run(char const* type, usize count) {
+        auto stdPush = mops(count, [&] {
+            std::vector<T> v;
+            for (usize i = 0; i < count; i++) {
+                v.push_back(make<T>(i));
+            }
+            return v.size();
+        });
+        auto glxPush = mops(count, [&] {
+            Vector<T> v;
+            for (usize i = 0; i < count; i++) {
+                v.push_back(make<T>(i));
+            }
+            return v.size();
+        });
+        report(type, "push_back", count, stdPush, glxPush);
+
+        /// Inserting in the middle moves half of the elements each time, so fewer elements keep it in cache.
+        auto inserts = count / 256;
+        auto stdInsert = mops(inserts, [&] {
+            std::vector<T> v;
+            for (usize i = 0; i < inserts; i++) {
+                v.insert(v.begin() + v.size() / 2, make<T>(i));
+            }
+            return v.size();
+        });
+        auto glxInsert = mops(inserts, [&] {
+            Vector<T> v;
+            for (usize i = 0; i < inserts; i++) {
+                v.insert(v.size() / 2, make<T>(i));
+            }
+            return v.size();
+        });
+        report(type, "insert", inserts, stdInsert, glxInsert);
+    }
+
+    /// Append `count` elements in runs of `kRunLength` from a source buffer.
+    void run_append(usize count) {
+        std::vector<uint64> src(kRunLength);
+        for (usize i = 0; i < kRunLength; i++) {
+            src[i] = uint64(i);
+        }
+        auto stdAppend = mops(count, [&] {
+            std::vector<uint64> v;
+            for (usize i = 0; i < count; i += kRunLength) {
+                v.insert(v.end(), src.begin(), src.end());
+            }
+            return v.size();
+        });
+        auto glxAppend = mops(count, [&] {
+            Vector<uint64> v;
+            for (usize i = 0; i < count; i += kRunLength) {
+                v.append_range(src.data(), kRunLength);
+            }
+            return v.size();
+        });
+        report("uint64", "append", count, stdAppend, glxAppend);
+    }
+}
+
+int main(int argc, char** argv) {
+    usize count = argc > 1 ? usize(std::atoll(argv[1])) : usize(1) << 22;
+    std::printf("%-8s %-10s %10s %12s %12s %8s\n", "type", "operation", "elements", "std Mops/s", "glx Mops/s", "speedup");
+    run<uint64>("uint64", count);
+    run<mem::Unique<int>>("Unique", count);
+    run_append(count);
+    return int(gSink & 0);
+}
@@ -31,6 +31,7 @@
 #ifndef __GLX__CORE__BASIC_TYPES__HPP__
 #define __GLX__CORE__BASIC_TYPES__HPP__
 #include <cstdint>
+#include <cstddef>
 
 namespace glx {
     using uint8     = uint8_t;
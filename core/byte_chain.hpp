@@ -0,0 +1,659 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file provides `ByteChain`, a sequence of bytes stored as a list of views into reference-counted blocks.
+ * Slicing, splitting and joining chains move views instead of bytes, so framing and reassembly never copy the
+ * payload; `coalesce` copies only when a contiguous run is really needed. A chain exports its views as `iovec`s
+ * and reads and writes file descriptors with `readv` and `writev`.
+ * 
+ * @file byte_chain.hpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#ifndef __GLX__CORE__BYTE__CHAIN__HPP__
+#define __GLX__CORE__BYTE__CHAIN__HPP__
+#include "basic_types.hpp"
+#include "status_code.hpp"
+#include "mem_utilities.hpp"
+#include "mem_shared.hpp"
+#include "mem_object_pool.hpp"
+#include <cstring>
+#if defined(__linux__)
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+namespace glx {
+    namespace __ignore {
+        ///
+        /// `ByteBlock` heads a block of `capacity` bytes from `mem::allocate`. Bytes below `used` are written and
+        /// never change again; the views holding the block share it by `refs`, so it may be read by several threads.
+        /// @author ZhangKeyangZzz
+        ///
+        struct ByteBlock {
+            mem::AtomicRefCount refs;
+            usize               capacity;
+            usize               used;
+
+            byte* bytes() noexcept { return reinterpret_cast<byte*>(this + 1); }
+
+            /// Allocate a block of `capacity` bytes held by one reference, or return nullptr.
+            static ByteBlock* create(usize capacity) noexcept {
+                if (capacity > usize(-1) - sizeof(ByteBlock)) {
+                    return nullptr;
+                }
+                auto block = reinterpret_cast<ByteBlock*>(mem::allocate<byte>(sizeof(ByteBlock) + capacity));
+                if (block != nullptr) {
+                    mem::construct(block);
+                    block->refs.value.store(1, std::memory_order_relaxed);
+                    block->capacity = capacity;
+                    block->used     = 0;
+                }
+                return block;
+            }
+
+            void acquire() noexcept { refs.acquire(); }
+
+            void release() noexcept {
+                if (refs.release()) {
+                    auto bytes = sizeof(ByteBlock) + capacity;
+                    mem::destruct(this);
+                    mem::deallocate(this, bytes);
+                }
+            }
+        };
+
+        /// A view of `length` bytes from `offset` in `block`, linked both ways. Views come from `ObjectPool`.
+        struct ByteSegment {
+            ByteSegment* prev;
+            ByteSegment* next;
+            ByteBlock*   block;
+            usize        offset;
+            usize        length;
+
+            byte* data() noexcept { return block->bytes() + offset; }
+
+            /// Whether the view may grow into the unwritten bytes of its block: it's the only view and ends at `used`.
+            usize room() const noexcept {
+                return block->refs.load() == 1 && offset + length == block->used ? block->capacity - block->used : 0;
+            }
+        };
+
+        /// Take a view of `length` bytes from `offset` in `block`, which gains a reference.
+        inline ByteSegment* __make_segment(ByteBlock* block, usize offset, usize length) noexcept {
+            auto segment = mem::ObjectPool<ByteSegment>::allocate();
+            if (segment != nullptr) {
+                block->acquire();
+                *segment = ByteSegment{ nullptr, nullptr, block, offset, length };
+            }
+            return segment;
+        }
+
+        /// Allocate a block of `capacity` bytes and the view of its first `length` bytes, which holds the only
+        /// reference. Returns nullptr with nothing allocated if the memory is exhausted.
+        inline ByteSegment* __make_block_segment(usize capacity, usize length) noexcept {
+            auto block = ByteBlock::create(capacity);
+            if (block == nullptr) {
+                return nullptr;
+            }
+            auto segment = mem::ObjectPool<ByteSegment>::allocate();
+            if (segment == nullptr) {
+                block->release();
+                return nullptr;
+            }
+            block->used = length;
+            *segment = ByteSegment{ nullptr, nullptr, block, 0, length };
+            return segment;
+        }
+
+        inline void __drop_segment(ByteSegment* segment) noexcept {
+            segment->block->release();
+            mem::ObjectPool<ByteSegment>::deallocate(segment);
+        }
+    }
+
+    /**
+     * `ByteChain` holds a sequence of bytes as a list of views into shared blocks. Moving bytes between chains
+     * (`append`, `prepend` and `split_front` of a chain) relinks views in O(1) per view touched, `slice` shares
+     * the blocks of a range with a new chain, and `consume`/`trim_back` drop bytes from either end; none of them
+     * copies a byte. Bytes enter a chain by `append`, `prepend` or `read_from`, which write them into blocks of
+     * `kBlockBytes`, filling the room left at the end of the last block first.
+     * 
+     * A chain belongs to one thread at a time; chains sharing blocks may live on different threads, since
+     * written bytes never change and blocks are counted atomically.
+     * @author ZhangKeyangZzz
+     * @note Operations that allocate return `OutOfMemory` on failure and leave the chain as it was.
+     */
+    class ByteChain {
+        using _Segment = __ignore::ByteSegment;
+
+        _Segment* _head     = nullptr;
+        _Segment* _tail     = nullptr;
+        usize     _size     = 0;
+        usize     _segments = 0;
+
+    public:
+        /// The payload of a block made for new bytes; with its header it fills a 4 KB size class.
+        static constexpr usize kBlockBytes = 4096 - sizeof(__ignore::ByteBlock);
+        /// The most `iovec`s `read_from` and `write_to` pass to one system call.
+        static constexpr usize kMaxIovecs  = 64;
+
+        ByteChain() noexcept = default;
+        ByteChain(ByteChain const&) = delete;
+        ByteChain(ByteChain&& rhs) noexcept : _head(rhs._head), _tail(rhs._tail), _size(rhs._size), _segments(rhs._segments) {
+            rhs._reset();
+        }
+        ~ByteChain() noexcept { clear(); }
+
+    public:
+        ByteChain& operator=(ByteChain const&) = delete;
+        ByteChain& operator=(ByteChain&& rhs) noexcept {
+            if (this != &rhs) {
+                clear();
+                _head     = rhs._head;
+                _tail     = rhs._tail;
+                _size     = rhs._size;
+                _segments = rhs._segments;
+                rhs._reset();
+            }
+            return *this;
+        }
+
+    public:
+        usize size() const noexcept { return _size; }
+        bool empty() const noexcept { return _size == 0; }
+        /// Return the count of views, which is the count of `iovec`s the chain exports.
+        usize segment_count() const noexcept { return _segments; }
+
+        /// Return the first contiguous run of bytes, `front_length()` bytes long, or nullptr if the chain is empty.
+        byte const* data() const noexcept { return _head != nullptr ? _head->data() : nullptr; }
+        usize front_length() const noexcept { return _head != nullptr ? _head->length : 0; }
+
+        /// Drop every byte.
+        void clear() noexcept {
+            while (_head != nullptr) {
+                auto next = _head->next;
+                __ignore::__drop_segment(_head);
+                _head = next;
+            }
+            _reset();
+        }
+
+        /**
+         * Copy `bytes` bytes from `src` to the end of the chain.
+         * @author ZhangKeyangZzz
+         * @param[in] src The bytes.
+         * @param[in] bytes The count of bytes.
+         * @return Returns `Success`, `IllegalArgument` if `src` is nullptr, or `OutOfMemory`.
+         */
+        int append(void const* src, usize bytes) noexcept {
+            if (bytes == 0) {
+                return StatusCode::Success;
+            }
+            if (src == nullptr) {
+                return StatusCode::IllegalArgument;
+            }
+            auto from  = reinterpret_cast<byte const*>(src);
+            auto room  = _tail != nullptr ? _tail->room() : 0;
+            auto first = bytes < room ? bytes : room;
+            ByteChain rest;
+            if (bytes > first) {
+                auto status = rest._append_block(from + first, bytes - first, bytes - first > kBlockBytes ? bytes - first : kBlockBytes);
+                if (status != StatusCode::Success) {
+                    return status;
+                }
+            }
+            if (first > 0) {
+                memcpy(_tail->data() + _tail->length, from, first);
+                _tail->block->used += first;
+                _tail->length      += first;
+                _size              += first;
+            }
+            return append(std::move(rest));
+        }
+
+        /**
+         * Copy `bytes` bytes from `src` to the front of the chain, as a header is put in front of a payload.
+         * @author ZhangKeyangZzz
+         * @param[in] src The bytes.
+         * @param[in] bytes The count of bytes.
+         * @return Returns `Success`, `IllegalArgument` if `src` is nullptr, or `OutOfMemory`.
+         */
+        int prepend(void const* src, usize bytes) noexcept {
+            if (bytes == 0) {
+                return StatusCode::Success;
+            }
+            if (src == nullptr) {
+                return StatusCode::IllegalArgument;
+            }
+            ByteChain front;
+            auto status = front._append_block(reinterpret_cast<byte const*>(src), bytes, bytes);
+            if (status != StatusCode::Success) {
+                return status;
+            }
+            return prepend(std::move(front));
+        }
+
+        /// Move every byte of `rhs` to the end of this chain, leaving `rhs` empty. O(1).
+        int append(ByteChain&& rhs) noexcept {
+            if (this == &rhs || rhs._head == nullptr) {
+                return StatusCode::Success;
+            }
+            if (_tail == nullptr) {
+                _head = rhs._head;
+            } else {
+                _tail->next     = rhs._head;
+                rhs._head->prev = _tail;
+            }
+            _tail      = rhs._tail;
+            _size     += rhs._size;
+            _segments += rhs._segments;
+            rhs._reset();
+            return StatusCode::Success;
+        }
+
+        /// Move every byte of `rhs` to the front of this chain, leaving `rhs` empty. O(1).
+        int prepend(ByteChain&& rhs) noexcept {
+            if (this == &rhs || rhs._head == nullptr) {
+                return StatusCode::Success;
+            }
+            rhs.append(std::move(*this));
+            return append(std::move(rhs));
+        }
+
+        /**
+         * Drop the first `bytes` bytes.
+         * @author ZhangKeyangZzz
+         * @param[in] bytes The count of bytes.
+         * @return Returns `Success`, or `IndexOutOfRange` if the chain is shorter.
+         */
+        int consume(usize bytes) noexcept {
+            if (bytes > _size) {
+                return StatusCode::IndexOutOfRange;
+            }
+            _size -= bytes;
+            while (bytes > 0 && bytes >= _head->length) {
+                bytes -= _head->length;
+                _unlink(_head);
+            }
+            if (bytes > 0) {
+                _head->offset += bytes;
+                _head->length -= bytes;
+            }
+            return StatusCode::Success;
+        }
+
+        /**
+         * Drop the last `bytes` bytes.
+         * @author ZhangKeyangZzz
+         * @param[in] bytes The count of bytes.
+         * @return Returns `Success`, or `IndexOutOfRange` if the chain is shorter.
+         */
+        int trim_back(usize bytes) noexcept {
+            if (bytes > _size) {
+                return StatusCode::IndexOutOfRange;
+            }
+            _size -= bytes;
+            while (bytes > 0 && bytes >= _tail->length) {
+                bytes -= _tail->length;
+                _unlink(_tail);
+            }
+            if (bytes > 0) {
+                _tail->length -= bytes;
+            }
+            return StatusCode::Success;
+        }
+
+        /**
+         * Move the first `bytes` bytes to `front`, as a frame is cut off a stream. Whole views are relinked; a view
+         * straddling the cut is shared by both chains.
+         * @author ZhangKeyangZzz
+         * @param[in] bytes The count of bytes.
+         * @param[out] front Receives the bytes; what it held before is dropped.
+         * @return Returns `Success`, `IndexOutOfRange` if the chain is shorter, or `OutOfMemory`.
+         */
+        int split_front(usize bytes, ByteChain& front) noexcept {
+            if (bytes > _size) {
+                return StatusCode::IndexOutOfRange;
+            }
+            if (&front == this) {
+                return StatusCode::IllegalArgument;
+            }
+            ByteChain taken;
+            while (bytes > 0 && _head->length <= bytes) {
+                bytes -= _head->length;
+                taken._link_back(_pop_front());
+            }
+            if (bytes > 0) {
+                auto share = __ignore::__make_segment(_head->block, _head->offset, bytes);
+                if (share == nullptr) {
+                    prepend(std::move(taken));
+                    return StatusCode::OutOfMemory;
+                }
+                _head->offset += bytes;
+                _head->length -= bytes;
+                _size         -= bytes;
+                taken._link_back(share);
+            }
+            front = std::move(taken);
+            return StatusCode::Success;
+        }
+
+        /**
+         * Share `length` bytes from `offset` with `result`, without copying: `result` holds views of the same blocks.
+         * @author ZhangKeyangZzz
+         * @param[in] offset The offset of the first byte.
+         * @param[in] length The count of bytes.
+         * @param[out] result Receives the bytes; what it held before is dropped.
+         * @return Returns `Success`, `IndexOutOfRange` if the range runs past the end, or `OutOfMemory`.
+         */
+        int slice(usize offset, usize length, ByteChain& result) const noexcept {
+            if (offset > _size || length > _size - offset) {
+                return StatusCode::IndexOutOfRange;
+            }
+            if (&result == this) {
+                return StatusCode::IllegalArgument;
+            }
+            ByteChain built;
+            auto segment = _head;
+            while (segment != nullptr && offset >= segment->length) {
+                offset -= segment->length;
+                segment = segment->next;
+            }
+            while (length > 0) {
+                auto take  = segment->length - offset < length ? segment->length - offset : length;
+                auto share = __ignore::__make_segment(segment->block, segment->offset + offset, take);
+                if (share == nullptr) {
+                    return StatusCode::OutOfMemory;
+                }
+                built._link_back(share);
+                length -= take;
+                offset  = 0;
+                segment = segment->next;
+            }
+            result = std::move(built);
+            return StatusCode::Success;
+        }
+
+        /**
+         * Copy `bytes` bytes from `offset` to `dst`, to read a header without coalescing the chain.
+         * @author ZhangKeyangZzz
+         * @param[in] offset The offset of the first byte.
+         * @param[out] dst The buffer of at least `bytes` bytes.
+         * @param[in] bytes The count of bytes.
+         * @return Returns `Success`, `IllegalArgument` if `dst` is nullptr, or `IndexOutOfRange` if the range runs
+         *         past the end.
+         */
+        int copy_out(usize offset, void* dst, usize bytes) const noexcept {
+            if (offset > _size || bytes > _size - offset) {
+                return StatusCode::IndexOutOfRange;
+            }
+            if (dst == nullptr && bytes > 0) {
+                return StatusCode::IllegalArgument;
+            }
+            auto to      = reinterpret_cast<byte*>(dst);
+            auto segment = _head;
+            while (segment != nullptr && offset >= segment->length) {
+                offset -= segment->length;
+                segment = segment->next;
+            }
+            while (bytes > 0) {
+                auto take = segment->length - offset < bytes ? segment->length - offset : bytes;
+                memcpy(to, segment->data() + offset, take);
+                to     += take;
+                bytes  -= take;
+                offset  = 0;
+                segment = segment->next;
+            }
+            return StatusCode::Success;
+        }
+
+        /**
+         * Make the first `bytes` bytes contiguous, so `data()` covers them. Views already long enough are kept; 
+         * otherwise the bytes are copied once into a new block.
+         * @author ZhangKeyangZzz
+         * @param[in] bytes The count of bytes.
+         * @return Returns `Success`, `IndexOutOfRange` if the chain is shorter, or `OutOfMemory`.
+         */
+        int coalesce(usize bytes) noexcept {
+            if (bytes > _size) {
+                return StatusCode::IndexOutOfRange;
+            }
+            if (bytes == 0 || _head->length >= bytes) {
+                return StatusCode::Success;
+            }
+            auto segment = __ignore::__make_block_segment(bytes, bytes);
+            if (segment == nullptr) {
+                return StatusCode::OutOfMemory;
+            }
+            copy_out(0, segment->data(), bytes);
+            consume(bytes);
+            _link_front(segment);
+            return StatusCode::Success;
+        }
+
+        /// Make the whole chain contiguous, see `coalesce(bytes)`.
+        int coalesce() noexcept {
+            return coalesce(_size);
+        }
+
+#if defined(__linux__)
+        /**
+         * Describe the views from the `first`th on as `iovec`s, for `writev`, `sendmsg` or `io_uring`.
+         * @author ZhangKeyangZzz
+         * @param[out] vectors The array receiving the views.
+         * @param[in] count The length of `vectors`.
+         * @param[in] first The count of views to skip.
+         * @return Returns the count of `iovec`s written, less than `count` once the chain ends.
+         * @note The `iovec`s stay valid while the chain keeps the bytes they point to.
+         */
+        usize export_iovecs(iovec* vectors, usize count, usize first = 0) const noexcept {
+            auto segment = _head;
+            for (; segment != nullptr && first > 0; first--) {
+                segment = segment->next;
+            }
+            usize written = 0;
+            for (; segment != nullptr && written < count; segment = segment->next, written++) {
+                vectors[written].iov_base = segment->data();
+                vectors[written].iov_len  = segment->length;
+            }
+            return written;
+        }
+
+        /**
+         * Write the chain to `fd` with one `writev` of up to `kMaxIovecs` views, and drop the bytes written.
+         * @author ZhangKeyangZzz
+         * @param[in] fd The file descriptor.
+         * @param[out] written Receives the count of bytes written, which may be short of `size()`.
+         * @return Returns `Success`, or `IOError` with `errno` set, `EAGAIN` for a full non-blocking descriptor.
+         */
+        int write_to(int fd, usize& written) noexcept {
+            written = 0;
+            if (_size == 0) {
+                return StatusCode::Success;
+            }
+            iovec vectors[kMaxIovecs];
+            auto count = export_iovecs(vectors, kMaxIovecs);
+            auto bytes = ::writev(fd, vectors, int(count));
+            if (bytes < 0) {
+                return StatusCode::IOError;
+            }
+            written = usize(bytes);
+            consume(written);
+            return StatusCode::Success;
+        }
+
+        /**
+         * Read up to `bytes` bytes from `fd` with one `readv` and append them. The room at the end of the last
+         * block is filled first, the rest goes to new blocks of `kBlockBytes`, at most `kMaxIovecs` of them;
+         * blocks left unfilled are freed.
+         * @author ZhangKeyangZzz
+         * @param[in] fd The file descriptor.
+         * @param[in] bytes The most bytes to read.
+         * @param[out] received Receives the count of bytes read, 0 at the end of the file.
+         * @return Returns `Success`, `OutOfMemory` if there was no room to read into, or `IOError` with `errno` set,
+         *         `EAGAIN` for an empty non-blocking descriptor.
+         */
+        int read_from(int fd, usize bytes, usize& received) noexcept {
+            received = 0;
+            if (bytes == 0) {
+                return StatusCode::Success;
+            }
+            iovec     vectors[kMaxIovecs];
+            _Segment* fresh[kMaxIovecs];
+            usize     count  = 0;
+            usize     blocks = 0;
+            auto      room   = _tail != nullptr ? _tail->room() : 0;
+            if (room > 0) {
+                vectors[count].iov_base = _tail->data() + _tail->length;
+                vectors[count].iov_len  = room < bytes ? room : bytes;
+                bytes -= vectors[count].iov_len;
+                count++;
+            }
+            for (; bytes > 0 && count < kMaxIovecs; count++, blocks++) {
+                auto segment = __ignore::__make_block_segment(kBlockBytes, 0);
+                if (segment == nullptr) {
+                    break;
+                }
+                fresh[blocks] = segment;
+                vectors[count].iov_base = segment->data();
+                vectors[count].iov_len  = kBlockBytes < bytes ? kBlockBytes : bytes;
+                bytes -= vectors[count].iov_len;
+            }
+            if (count == 0) {
+                return StatusCode::OutOfMemory;
+            }
+            auto result = ::readv(fd, vectors, int(count));
+            auto left   = result > 0 ? usize(result) : 0;
+            received = left;
+            if (room > 0) {
+                auto take = left < vectors[0].iov_len ? left : vectors[0].iov_len;
+                _tail->block->used += take;
+                _tail->length      += take;
+                _size              += take;
+                left               -= take;
+            }
+            for (usize i = 0; i < blocks; i++) {
+                auto take = left < kBlockBytes ? left : kBlockBytes;
+                if (take == 0) {
+                    __ignore::__drop_segment(fresh[i]);
+                    continue;
+                }
+                fresh[i]->block->used = take;
+                fresh[i]->length      = take;
+                _link_back(fresh[i]);
+                left -= take;
+            }
+            return result < 0 ? int(StatusCode::IOError) : int(StatusCode::Success);
+        }
+#endif
+
+    private:
+        void _reset() noexcept {
+            _head     = nullptr;
+            _tail     = nullptr;
+            _size     = 0;
+            _segments = 0;
+        }
+
+        /// Add a view at the end, counting its bytes.
+        void _link_back(_Segment* segment) noexcept {
+            segment->prev = _tail;
+            segment->next = nullptr;
+            if (_tail == nullptr) {
+                _head = segment;
+            } else {
+                _tail->next = segment;
+            }
+            _tail = segment;
+            _size += segment->length;
+            _segments++;
+        }
+
+        /// Add a view at the front, counting its bytes.
+        void _link_front(_Segment* segment) noexcept {
+            segment->prev = nullptr;
+            segment->next = _head;
+            if (_head == nullptr) {
+                _tail = segment;
+            } else {
+                _head->prev = segment;
+            }
+            _head = segment;
+            _size += segment->length;
+            _segments++;
+        }
+
+        /// Remove the first view and return it, with its bytes and its reference.
+        _Segment* _pop_front() noexcept {
+            auto segment = _head;
+            _head = segment->next;
+            if (_head == nullptr) {
+                _tail = nullptr;
+            } else {
+                _head->prev = nullptr;
+            }
+            _size -= segment->length;
+            _segments--;
+            return segment;
+        }
+
+        /// Remove a view and drop its reference, without counting its bytes.
+        void _unlink(_Segment* segment) noexcept {
+            if (segment->prev == nullptr) {
+                _head = segment->next;
+            } else {
+                segment->prev->next = segment->next;
+            }
+            if (segment->next == nullptr) {
+                _tail = segment->prev;
+            } else {
+                segment->next->prev = segment->prev;
+            }
+            _segments--;
+            __ignore::__drop_segment(segment);
+        }
+
+        /// Copy `bytes` bytes to the end, into a new block of `capacity` bytes.
+        int _append_block(byte const* src, usize bytes, usize capacity) noexcept {
+            auto segment = __ignore::__make_block_segment(capacity, bytes);
+            if (segment == nullptr) {
+                return StatusCode::OutOfMemory;
+            }
+            memcpy(segment->data(), src, bytes);
+            _link_back(segment);
+            return StatusCode::Success;
+        }
+    };
+
+    namespace mem {
+        /// `ByteChain` is two pointers and two counts, so it relocates by copying its bytes.
+        template <>
+        struct is_trivially_relocatable<ByteChain> : std::true_type {};
+    }
+}
+
+#endif
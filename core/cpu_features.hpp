@@ -0,0 +1,151 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file detects the SIMD extensions of the running CPU in sub-namespace `cpu`.
+ * 
+ * @file cpu_features.hpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#ifndef __GLX__CORE__CPU__FEATURES__HPP__
+#define __GLX__CORE__CPU__FEATURES__HPP__
+#include "basic_types.hpp"
+#include <cstdlib>
+#include <cstring>
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#define GLX_X86_SIMD 1
+#endif
+
+namespace glx {
+    namespace cpu {
+        /**
+         * The SIMD instruction sets the memory kernels know about, ordered by width.
+         * @author ZhangKeyangZzz
+         */
+        enum SimdLevel : uint8 {
+            Scalar = 0,     /// No vector kernels.
+            SSE2   = 1,     /// 128-bit kernels.
+            AVX2   = 2,     /// 256-bit kernels.
+            AVX512 = 3,     /// 512-bit kernels, requires AVX-512F and AVX-512BW.
+        };
+
+        namespace __ignore {
+#if defined(GLX_X86_SIMD)
+            /// Read the extended control register, which tells whether the OS saves the wide vector state.
+            inline uint64 __xgetbv() noexcept {
+                uint32 eax, edx;
+                __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+                return (uint64(edx) << 32) | eax;
+            }
+#endif
+
+            inline SimdLevel __detect_simd_level() noexcept {
+#if defined(GLX_X86_SIMD)
+                uint32 eax, ebx, ecx, edx;
+                if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || (edx & bit_SSE2) == 0) {
+                    return Scalar;
+                }
+                auto level = SSE2;
+                if ((ecx & bit_OSXSAVE) == 0) {
+                    return level;
+                }
+                auto xcr0 = __xgetbv();
+                if ((xcr0 & 0x6) != 0x6 || !__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+                    return level;
+                }
+                if ((ebx & bit_AVX2) != 0) {
+                    level = AVX2;
+                }
+                if ((xcr0 & 0xe6) == 0xe6 && (ebx & bit_AVX512F) != 0 && (ebx & bit_AVX512BW) != 0) {
+                    level = AVX512;
+                }
+                return level;
+#else
+                return Scalar;
+#endif
+            }
+
+            /// The environment variable `GLX_SIMD` (`scalar`, `sse2`, `avx2`, `avx512`) caps the detected level,
+            /// which lets benchmarks compare kernels on one machine.
+            inline SimdLevel __capped_simd_level() noexcept {
+                auto level = __detect_simd_level();
+                auto cap   = std::getenv("GLX_SIMD");
+                if (cap == nullptr) {
+                    return level;
+                }
+                SimdLevel limit = level;
+                if (std::strcmp(cap, "scalar") == 0) {
+                    limit = Scalar;
+                } else if (std::strcmp(cap, "sse2") == 0) {
+                    limit = SSE2;
+                } else if (std::strcmp(cap, "avx2") == 0) {
+                    limit = AVX2;
+                }
+                return limit < level ? limit : level;
+            }
+        }
+
+        namespace __ignore {
+            /// Ask the C library for the size of the largest cache, assuming 8 MiB if it doesn't know.
+            inline usize __detect_last_level_cache_bytes() noexcept {
+                long bytes = 0;
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+                bytes = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+                if (bytes <= 0) {
+                    bytes = sysconf(_SC_LEVEL2_CACHE_SIZE);
+                }
+#endif
+                return bytes > 0 ? usize(bytes) : usize(8) << 20;
+            }
+        }
+
+        /**
+         * Return the size of the last level cache in bytes. Detected once per process.
+         * @author ZhangKeyangZzz
+         */
+        inline usize last_level_cache_bytes() noexcept {
+            static const usize bytes = __ignore::__detect_last_level_cache_bytes();
+            return bytes;
+        }
+
+        /**
+         * Return the widest SIMD level supported by both the CPU and the OS. Detected once per process.
+         * @author ZhangKeyangZzz
+         */
+        inline SimdLevel simd_level() noexcept {
+            static const SimdLevel level = __ignore::__capped_simd_level();
+            return level;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,1840 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file provides the size-class pool allocator behind `mem::allocate` and `mem::deallocate`.
+ * 
+ * Small requests are rounded up to one of `kSizeClassCount` size classes. Every thread owns a cache 
+ * holding a free list per size class, so the common path never takes a lock. Free lists overflow into
+ * (and refill from) a central free list in batches, which is the only place where threads meet.
+ * A small block remembers the cache it came from; freed on another thread, it is pushed onto a lock-free 
+ * queue of that cache, which takes the whole queue back when its own list runs dry.
+ * Large requests bypass the pool and go straight to the system heap, or are mapped from the system when they
+ * reach `mem::map_threshold`, so that freeing them gives the pages back at once. Over-aligned and huge-page 
+ * blocks are described by their header, so a single `mem::deallocate` releases every kind of block.
+ * 
+ * @file mem_allocator.hpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#ifndef __GLX__CORE__MEM__ALLOCATOR__HPP__
+#define __GLX__CORE__MEM__ALLOCATOR__HPP__
+#include "basic_types.hpp"
+#include <new>
+#include <mutex>
+#include <atomic>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <cmath>
+#include <chrono>
+#include <thread>
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/syscall.h>
+#endif
+#if defined(__GLIBC__)
+#include <execinfo.h>
+#endif
+
+/// `mremap` is a GNU extension; without it mapped blocks are resized by copying.
+#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+#define GLX_HAS_MREMAP 1
+#else
+#define GLX_HAS_MREMAP 0
+#endif
+
+/// Marks rarely taken paths so that the code around them stays small enough to inline.
+#if defined(__GNUC__)
+#define GLX_COLD __attribute__((noinline, cold))
+#else
+#define GLX_COLD
+#endif
+
+/// The sampling heap profiler is compiled in unless this is defined to 0; it costs one branch while stopped.
+#if !defined(GLX_MEM_PROFILE)
+#define GLX_MEM_PROFILE 1
+#endif
+
+/// Allocation tracing is compiled in unless this is defined to 0; it costs one branch per call while stopped.
+#if !defined(GLX_MEM_TRACE)
+#define GLX_MEM_TRACE 1
+#endif
+
+/// Allocation statistics are always on unless this is defined to 0.
+#if !defined(GLX_MEM_STATS)
+#define GLX_MEM_STATS 1
+#endif
+
+namespace glx {
+    namespace mem {
+        /// The assumed size of a cache line. Data written by different threads should not share one.
+        constexpr usize kCacheLineBytes = 64;
+
+        /// The size of a transparent huge page on x86-64 and AArch64 Linux.
+        constexpr usize kHugePageBytes  = 2 * 1024 * 1024;
+
+        /// Blocks of at least this many bytes are mapped from the system unless `mem::set_map_threshold` says otherwise.
+        constexpr usize kDefaultMapThreshold = 4 * 1024 * 1024;
+
+        namespace __ignore {
+            class ThreadCache;
+
+            ///
+            /// Every block handed out by the allocator is preceded by this header.
+            /// For a small block, `bytes` records the length of the batch the block heads while it waits in the 
+            /// central free list, and `owner` the cache that allocated it while it is in use.
+            /// @author ZhangKeyangZzz
+            ///
+            struct BlockHeader {
+                uint16 sizeClass;       /// The size class of the block, or one of `kLargeClass`, `kAlignedClass`, `kHugeClass`, `kMappedClass`.
+                uint16 tag;             /// The statistics tag that was active when the block was allocated.
+                uint32 offset;          /// For aligned and huge blocks, the distance from the underlying block to the user pointer.
+                union {
+                    usize        bytes; /// The requested bytes of a large block, or the mapped bytes of a huge or mapped block.
+                    ThreadCache* owner; /// The cache a small block is freed to, nullptr if it was allocated without one.
+                };
+            };
+
+            constexpr usize  kBlockHeaderBytes = sizeof(BlockHeader);
+            constexpr uint32 kSizeClassCount   = 40;
+            constexpr uint32 kLargeClass       = kSizeClassCount;
+            constexpr uint32 kAlignedClass     = kSizeClassCount + 1;
+            constexpr uint32 kHugeClass        = kSizeClassCount + 2;
+            constexpr uint32 kMappedClass      = kSizeClassCount + 3;
+            constexpr uint16 kSampledFlag      = 0x8000;                /// Set in `sizeClass` of a sampled large block.
+            constexpr uint32 kStatBuckets      = kSizeClassCount + 3;   /// Mapped blocks are counted as large blocks.
+            constexpr usize  kMaxTags          = 64;
+            constexpr usize  kMaxSmallBytes    = 32 * 1024;
+            constexpr usize  kSlabBytes        = 64 * 1024;
+            static_assert(kBlockHeaderBytes == 16, "BlockHeader must keep user pointers 16-byte aligned.");
+
+            /// Size classes are 16-byte steps up to 128 bytes, then four steps per power of two up to `kMaxSmallBytes`.
+            constexpr usize __class_to_size(uint32 sizeClass) noexcept {
+                if (sizeClass < 8) {
+                    return usize(sizeClass + 1) * 16;
+                }
+                auto group = (sizeClass - 8) / 4;
+                auto step  = (sizeClass - 8) % 4;
+                return (usize(128) << group) + usize(step + 1) * (usize(32) << group);
+            }
+
+            /// Map a request of `bytes` to the smallest size class holding it. `bytes` must not exceed `kMaxSmallBytes`.
+            inline uint32 __size_to_class(usize bytes) noexcept {
+                if (bytes <= 128) {
+                    return bytes == 0 ? 0 : uint32((bytes + 15) / 16 - 1);
+                }
+                auto log2 = uint32(63 - __builtin_clzll(uint64(bytes - 1)));
+                return 8 + (log2 - 7) * 4 + uint32((bytes - 1) >> (log2 - 2)) - 4;
+            }
+
+            /// The count of blocks moved between a thread cache and the central free list at once.
+            constexpr uint32 __class_batch(uint32 sizeClass) noexcept {
+                auto count = kSlabBytes / __class_to_size(sizeClass);
+                return count < 2 ? 2 : count > 32 ? 32 : uint32(count);
+            }
+
+            static_assert(__class_to_size(kSizeClassCount - 1) == kMaxSmallBytes, "Size class table is inconsistent.");
+
+            inline BlockHeader* __header_of(void* ptr) noexcept {
+                return reinterpret_cast<BlockHeader*>(reinterpret_cast<byte*>(ptr) - kBlockHeaderBytes);
+            }
+
+            inline void*& __next_of(void* block) noexcept {
+                return *reinterpret_cast<void**>(block);
+            }
+
+            inline void*& __next_batch_of(void* block) noexcept {
+                return *(reinterpret_cast<void**>(block) + 1);
+            }
+
+            ///-------------------------------------------------------------------------------------
+            ///
+            /// NUMA nodes.
+            ///
+            ///-------------------------------------------------------------------------------------
+            /// Nodes beyond this share the caches of node `id % kMaxNumaNodes`.
+            constexpr uint32 kMaxNumaNodes = 8;
+
+            /// `MPOL_PREFERRED` of `<numaif.h>`: place pages on the node, or elsewhere once it is full.
+            constexpr int kNumaPreferred = 1;
+
+            /// Parse a node list such as "0", "0-1" or "0,2-3" and return the highest id plus one.
+            inline usize __parse_node_list(const char* text) noexcept {
+                usize count = 0;
+                usize value = 0;
+                auto  digits = false;
+                for (auto c = text; ; c++) {
+                    if (*c >= '0' && *c <= '9') {
+                        value  = value * 10 + usize(*c - '0');
+                        digits = true;
+                        continue;
+                    }
+                    if (digits && value + 1 > count) {
+                        count = value + 1;
+                    }
+                    value  = 0;
+                    digits = false;
+                    if (*c == '\0' || *c == '\n') {
+                        break;
+                    }
+                }
+                return count;
+            }
+
+            /// The count of NUMA nodes the kernel reports online, 1 if unknown.
+            inline usize __numa_node_count() noexcept {
+                static usize count = [] {
+                    usize nodes = 1;
+#if defined(__linux__)
+                    auto file = ::open("/sys/devices/system/node/online", O_RDONLY | O_CLOEXEC);
+                    if (file >= 0) {
+                        char text[256];
+                        auto length = ::read(file, text, sizeof(text) - 1);
+                        ::close(file);
+                        if (length > 0) {
+                            text[length] = '\0';
+                            auto parsed = __parse_node_list(text);
+                            nodes = parsed > 0 ? parsed : 1;
+                        }
+                    }
+#endif
+                    return nodes;
+                }();
+                return count;
+            }
+
+            /// The node of the CPU the calling thread runs on, 0 if unknown.
+            inline uint32 __current_node() noexcept {
+#if defined(__linux__) && defined(SYS_getcpu)
+                if (__numa_node_count() > 1) {
+                    unsigned cpu  = 0;
+                    unsigned node = 0;
+                    if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+                        return uint32(node);
+                    }
+                }
+#endif
+                return 0;
+            }
+
+            /// Map `length` bytes whose pages the kernel places on `node` when they are first touched.
+            /// Returns nullptr if the mapping fails; a failed binding leaves the default placement.
+            inline void* __node_pages(usize length, uint32 node) noexcept {
+#if defined(__linux__)
+                auto mapped = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (mapped == MAP_FAILED) {
+                    return nullptr;
+                }
+#if defined(SYS_mbind)
+                if (node < 64) {
+                    unsigned long mask = 1ul << node;
+                    ::syscall(SYS_mbind, mapped, length, kNumaPreferred, &mask, sizeof(mask) * 8, 0);
+                }
+#endif
+                return mapped;
+#else
+                (void)length, (void)node;
+                return nullptr;
+#endif
+            }
+
+            ///
+            /// `CentralFreeList` is the shared free list of one size class. It stores whole batches,
+            /// so a thread takes the lock once per `__class_batch` blocks instead of once per block.
+            /// @author ZhangKeyangZzz
+            ///
+            struct alignas(64) CentralFreeList {
+                std::mutex lock;
+                void*      batches = nullptr;   /// Stack of batches linked through the second word of their heads.
+                usize      batchCount = 0;
+            };
+
+            class CentralCache {
+                CentralFreeList _lists[kSizeClassCount];
+                uint32          _node = 0;
+
+            public:
+                explicit CentralCache(uint32 node) noexcept : _node(node) {}
+
+                /// Push a chain of `length` blocks starting at `head` as one batch.
+                void push(uint32 sizeClass, void* head, uint32 length) noexcept {
+                    auto& list = _lists[sizeClass];
+                    __header_of(head)->bytes = length;
+                    std::lock_guard<std::mutex> guard(list.lock);
+                    __next_batch_of(head) = list.batches;
+                    list.batches = head;
+                    list.batchCount++;
+                }
+
+                /// Pop one batch into `head`/`length`, carving a fresh slab when the list is empty.
+                bool pop(uint32 sizeClass, void*& head, uint32& length) noexcept {
+                    auto& list = _lists[sizeClass];
+                    {
+                        std::lock_guard<std::mutex> guard(list.lock);
+                        if (list.batches != nullptr) {
+                            head = list.batches;
+                            list.batches = __next_batch_of(head);
+                            list.batchCount--;
+                            length = uint32(__header_of(head)->bytes);
+                            return true;
+                        }
+                    }
+                    return _carve(sizeClass, head, length);
+                }
+
+            private:
+                /// Cut a new slab into blocks, keep the first batch and publish the rest.
+                bool _carve(uint32 sizeClass, void*& head, uint32& length) noexcept {
+                    auto blockBytes = kBlockHeaderBytes + __class_to_size(sizeClass);
+                    auto batch      = __class_batch(sizeClass);
+                    auto slabBytes  = kSlabBytes > blockBytes * batch ? kSlabBytes : blockBytes * batch;
+                    auto slab       = reinterpret_cast<byte*>(__numa_node_count() > 1
+                                    ? __node_pages(slabBytes, _node)
+                                    : std::malloc(slabBytes));
+                    if (slab == nullptr) {
+                        return false;
+                    }
+                    auto total = uint32(slabBytes / blockBytes);
+                    void* chain = nullptr;
+                    for (auto i = total; i > 0; i--) {
+                        auto header = reinterpret_cast<BlockHeader*>(slab + (i - 1) * blockBytes);
+                        header->sizeClass = uint16(sizeClass);
+                        header->tag       = 0;
+                        header->offset    = 0;
+                        header->bytes     = 0;
+                        auto block = reinterpret_cast<void*>(header + 1);
+                        __next_of(block) = chain;
+                        chain = block;
+                    }
+                    head   = chain;
+                    length = batch;
+                    for (uint32 i = 1; i < batch; i++) {
+                        chain = __next_of(chain);
+                    }
+                    auto rest = __next_of(chain);
+                    __next_of(chain) = nullptr;
+                    for (auto remaining = total - batch; remaining > 0; ) {
+                        auto count = remaining < batch ? remaining : batch;
+                        auto first = rest;
+                        for (uint32 i = 1; i < count; i++) {
+                            rest = __next_of(rest);
+                        }
+                        auto next = __next_of(rest);
+                        __next_of(rest) = nullptr;
+                        push(sizeClass, first, count);
+                        rest = next;
+                        remaining -= count;
+                    }
+                    return true;
+                }
+            };
+
+            /// The central caches live for the whole process; they're never destroyed so that frees issued
+            /// during static destruction still have somewhere to go. There is one per NUMA node, whose slabs
+            /// are placed on that node; a single-node machine only ever uses the first.
+            inline CentralCache& __central_cache(uint32 node = 0) noexcept {
+                static typename std::aligned_storage<sizeof(CentralCache), alignof(CentralCache)>::type storage[kMaxNumaNodes];
+                static CentralCache* central = [] {
+                    auto caches = reinterpret_cast<CentralCache*>(&storage[0]);
+                    for (uint32 i = 0; i < kMaxNumaNodes; i++) {
+                        new (&storage[i]) CentralCache(i);
+                    }
+                    return caches;
+                }();
+                return central[node % kMaxNumaNodes];
+            }
+
+            ///
+            /// A counter written by one thread and read by any. The owner updates it with a relaxed load and store,
+            /// which compiles to a plain increment, so counting costs nothing like an atomic read-modify-write.
+            /// @author ZhangKeyangZzz
+            ///
+            struct StatCounter {
+                std::atomic<uint64> value{ 0 };
+
+                void add(uint64 n) noexcept {
+                    value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+                }
+
+                /// For counters shared by several threads.
+                void add_shared(uint64 n) noexcept {
+                    value.fetch_add(n, std::memory_order_relaxed);
+                }
+
+                uint64 load() const noexcept {
+                    return value.load(std::memory_order_relaxed);
+                }
+            };
+
+            ///
+            /// The length of a free list. Only the owner writes it, with a relaxed load and store like `StatCounter`,
+            /// and `stats` reads it from other threads to derive the frees of the list.
+            /// @author ZhangKeyangZzz
+            ///
+            struct ListLength {
+                std::atomic<uint32> value{ 0 };
+
+                operator uint32() const noexcept { return value.load(std::memory_order_relaxed); }
+                ListLength& operator=(uint32 n) noexcept { value.store(n, std::memory_order_relaxed); return *this; }
+                ListLength& operator+=(uint32 n) noexcept { return *this = uint32(*this) + n; }
+                ListLength& operator-=(uint32 n) noexcept { return *this = uint32(*this) - n; }
+                ListLength& operator++() noexcept { return *this += 1; }
+                ListLength& operator--() noexcept { return *this -= 1; }
+            };
+
+            /// The blocks of one size class cached by a thread. The counter sits next to the list head,
+            /// whose cache line every allocation touches anyway; frees are not counted, see `ThreadCache::frees`.
+            struct FreeList {
+                void*       head = nullptr;
+                ListLength  length;
+                StatCounter allocations;
+            };
+
+            inline std::atomic<int64>& __live_bytes() noexcept {
+                static std::atomic<int64> bytes(0);
+                return bytes;
+            }
+
+            inline std::atomic<int64>& __peak_bytes() noexcept {
+                static std::atomic<int64> bytes(0);
+                return bytes;
+            }
+
+            /// Add `delta` to the published live bytes and raise the peak if needed.
+            inline void __publish_live(int64 delta) noexcept {
+                auto live = __live_bytes().fetch_add(delta, std::memory_order_relaxed) + delta;
+                auto peak = __peak_bytes().load(std::memory_order_relaxed);
+                while (live > peak && !__peak_bytes().compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+                }
+            }
+
+            /// Counters of one thread, per bucket (the size classes, then large and huge blocks) and per tag. An aligned
+            /// block is counted as the block it was carved from. Frees are counted by the freeing thread, so only the
+            /// sums over all threads are meaningful. A thread counts its small allocations in its free lists instead,
+            /// and of its small frees only those handed back to another thread in `frees`.
+            struct ThreadStats {
+                StatCounter allocations[kStatBuckets];
+                StatCounter frees[kStatBuckets];
+                StatCounter received[kSizeClassCount];  /// Small blocks put on the free list from outside the thread.
+                StatCounter released[kSizeClassCount];  /// Small blocks taken off the free list to the central cache.
+                StatCounter allocatedBytes[kStatBuckets];
+                StatCounter freedBytes[kStatBuckets];
+                StatCounter tagAllocations[kMaxTags];
+                StatCounter tagFrees[kMaxTags];
+                StatCounter tagAllocatedBytes[kMaxTags];
+                StatCounter tagFreedBytes[kMaxTags];
+                int64       publishedLive[kStatBuckets] = {};   /// What each bucket added to `__live_bytes`; owner only.
+            };
+
+            ///
+            /// `ThreadCache` holds the free lists of one thread. Caches are owned by `CacheRegistry`,
+            /// and are recycled rather than destroyed when their thread exits.
+            /// @author ZhangKeyangZzz
+            ///
+            class ThreadCache {
+                FreeList     _lists[kSizeClassCount];
+
+                /// Blocks of this cache freed by other threads, one stack per size class. Other threads only push,
+                /// the owner only takes the whole stack, so a compare-and-swap push has no ABA problem.
+                alignas(kCacheLineBytes) std::atomic<void*> _remote[kSizeClassCount];
+
+            public:
+                uint32       node      = 0;         /// The NUMA node of the thread, whose central cache this cache uses.
+                ThreadCache* nextCache = nullptr;   /// Link in the list of every cache ever created.
+                ThreadCache* nextIdle  = nullptr;   /// Link in the list of caches without a thread.
+                ThreadStats  stats;                 /// Counters, kept when the cache is recycled so totals never go back.
+
+            public:
+                uint64 allocations(uint32 bucket) const noexcept {
+                    return bucket < kSizeClassCount ? _lists[bucket].allocations.load() : stats.allocations[bucket].load();
+                }
+
+                /// A free list only grows by frees and by blocks received from outside, and only shrinks by allocations
+                /// and releases, so its frees follow from its length and need no counter on the hot path. Read from
+                /// another thread, the result may lag by the blocks the owner is moving at that moment.
+                uint64 frees(uint32 bucket) const noexcept {
+                    if (bucket >= kSizeClassCount) {
+                        return stats.frees[bucket].load();
+                    }
+                    auto& list = _lists[bucket];
+                    auto  out  = list.allocations.load() + stats.released[bucket].load() + uint32(list.length);
+                    return stats.frees[bucket].load() + out - stats.received[bucket].load();
+                }
+
+                /// Bring `__live_bytes` and the peak up to date with one bucket of this thread. A running live total
+                /// updated on every allocation would chain each one to the previous through memory, so a bucket is
+                /// published from its counters only when the thread goes to the central cache or the system for it.
+                /// A bucket can drift by about what its free list holds in between.
+                void publish(uint32 bucket) noexcept {
+                    auto live = bucket < kSizeClassCount
+                        ? int64(allocations(bucket) - frees(bucket)) * int64(__class_to_size(bucket))
+                        : int64(stats.allocatedBytes[bucket].load() - stats.freedBytes[bucket].load());
+                    if (live != stats.publishedLive[bucket]) {
+                        __publish_live(live - stats.publishedLive[bucket]);
+                        stats.publishedLive[bucket] = live;
+                    }
+                }
+
+                void publish_all() noexcept {
+                    for (uint32 bucket = 0; bucket < kStatBuckets; bucket++) {
+                        publish(bucket);
+                    }
+                }
+
+                ThreadCache() noexcept {
+                    for (auto& remote : _remote) {
+                        remote.store(nullptr, std::memory_order_relaxed);
+                    }
+                }
+
+                void* allocate(uint32 sizeClass) noexcept {
+                    auto& list = _lists[sizeClass];
+                    if (list.head == nullptr && !_refill(sizeClass)) {
+                        return nullptr;
+                    }
+                    auto block = list.head;
+                    list.head = __next_of(block);
+                    --list.length;
+#if GLX_MEM_STATS
+                    list.allocations.add(1);
+#endif
+                    return block;
+                }
+
+                void deallocate(uint32 sizeClass, void* block) noexcept {
+                    auto& list = _lists[sizeClass];
+                    __next_of(block) = list.head;
+                    list.head = block;
+                    ++list.length;
+                    auto batch = __class_batch(sizeClass);
+                    if (list.length > batch * 2) {
+                        _release(sizeClass, batch);
+                    }
+                }
+
+                /// Count a free by this thread of a block that went back to its owner; small frees are counted by the free list.
+                void count_free(uint32 sizeClass) noexcept {
+                    stats.frees[sizeClass].add(1);
+                }
+
+                /// Called on a thread other than the owner. Returns false if the owner has exited, then the caller
+                /// keeps the block.
+                bool push_remote(uint32 sizeClass, void* block) noexcept {
+                    auto& remote = _remote[sizeClass];
+                    auto  head   = remote.load(std::memory_order_relaxed);
+                    do {
+                        if (head == __closed()) {
+                            return false;
+                        }
+                        __next_of(block) = head;
+                    } while (!remote.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+                    return true;
+                }
+
+                /// Stop taking remote frees and move the pending ones to the free lists; called when the owner exits.
+                void close_remote() noexcept {
+                    for (uint32 sizeClass = 0; sizeClass < kSizeClassCount; sizeClass++) {
+                        _append(sizeClass, _remote[sizeClass].exchange(__closed(), std::memory_order_acquire));
+                    }
+                }
+
+                /// Take remote frees again; called when the cache is bound to a new thread.
+                void open_remote() noexcept {
+                    for (auto& remote : _remote) {
+                        remote.store(nullptr, std::memory_order_relaxed);
+                    }
+                }
+
+                /// Return every cached block to the central cache.
+                void flush() noexcept {
+                    for (uint32 sizeClass = 0; sizeClass < kSizeClassCount; sizeClass++) {
+                        auto batch = __class_batch(sizeClass);
+                        while (_lists[sizeClass].length > 0) {
+                            uint32 length = _lists[sizeClass].length;
+                            _release(sizeClass, length < batch ? length : batch);
+                        }
+                    }
+                }
+
+            private:
+                /// Marks the remote stack of a cache without a thread.
+                static void* __closed() noexcept {
+                    return reinterpret_cast<void*>(uintptr_t(1));
+                }
+
+                /// Refill an empty free list from the remote stack or else the central cache, returns false if both
+                /// are empty. Kept out of line, so that `allocate` stays small enough to be inlined into the caller.
+                GLX_COLD bool _refill(uint32 sizeClass) noexcept {
+                    if (_collect(sizeClass)) {
+                        return true;
+                    }
+                    void*  head;
+                    uint32 length;
+                    if (!__central_cache(node).pop(sizeClass, head, length)) {
+                        return false;
+                    }
+#if GLX_MEM_STATS
+                    stats.received[sizeClass].add(length);
+#endif
+                    _lists[sizeClass].head   = head;
+                    _lists[sizeClass].length = length;
+#if GLX_MEM_STATS
+                    publish(sizeClass);
+#endif
+                    return true;
+                }
+
+                /// Refill an empty free list from the remote stack, returns false if nothing was freed remotely.
+                bool _collect(uint32 sizeClass) noexcept {
+                    auto& remote = _remote[sizeClass];
+                    if (remote.load(std::memory_order_relaxed) == nullptr) {
+                        return false;
+                    }
+                    _append(sizeClass, remote.exchange(nullptr, std::memory_order_acquire));
+                    auto batch = __class_batch(sizeClass);
+                    while (_lists[sizeClass].length > batch * 2) {
+                        _release(sizeClass, batch);
+                    }
+                    return true;
+                }
+
+                /// Put a chain of blocks in front of a free list.
+                void _append(uint32 sizeClass, void* chain) noexcept {
+                    if (chain == nullptr || chain == __closed()) {
+                        return;
+                    }
+                    auto&  list   = _lists[sizeClass];
+                    auto   tail   = chain;
+                    uint32 length = 1;
+                    for (; __next_of(tail) != nullptr; length++) {
+                        tail = __next_of(tail);
+                    }
+#if GLX_MEM_STATS
+                    stats.received[sizeClass].add(length);
+#endif
+                    __next_of(tail) = list.head;
+                    list.head = chain;
+                    list.length += length;
+                }
+
+                /// Detach the first `count` blocks of a free list and hand them to the central cache.
+                GLX_COLD void _release(uint32 sizeClass, uint32 count) noexcept {
+                    auto& list = _lists[sizeClass];
+                    auto first = list.head;
+                    auto last  = first;
+                    for (uint32 i = 1; i < count; i++) {
+                        last = __next_of(last);
+                    }
+                    list.head = __next_of(last);
+                    list.length -= count;
+                    __next_of(last) = nullptr;
+                    __central_cache(node).push(sizeClass, first, count);
+#if GLX_MEM_STATS
+                    stats.released[sizeClass].add(count);
+                    publish(sizeClass);
+#endif
+                }
+            };
+
+            class CacheRegistry {
+                std::mutex   _lock;
+                ThreadCache* _caches = nullptr;
+                ThreadCache* _idle   = nullptr;
+
+            public:
+                /// Bind a cache to the calling thread, reusing one left behind by an exited thread if possible.
+                ThreadCache* acquire() noexcept {
+                    std::lock_guard<std::mutex> guard(_lock);
+                    if (_idle != nullptr) {
+                        auto cache = _idle;
+                        _idle = cache->nextIdle;
+                        cache->nextIdle = nullptr;
+                        cache->node     = __current_node();
+                        cache->open_remote();
+                        return cache;
+                    }
+                    auto storage = std::malloc(sizeof(ThreadCache));
+                    if (storage == nullptr) {
+                        return nullptr;
+                    }
+                    auto cache = new (storage) ThreadCache();
+                    cache->node      = __current_node();
+                    cache->nextCache = _caches;
+                    _caches = cache;
+                    return cache;
+                }
+
+                /// Called when the owning thread exits.
+                void release(ThreadCache* cache) noexcept {
+                    cache->close_remote();
+                    cache->flush();
+                    std::lock_guard<std::mutex> guard(_lock);
+                    cache->nextIdle = _idle;
+                    _idle = cache;
+                }
+
+                /// Call `visit(cache)` for every cache ever created, bound to a thread or not.
+                template <typename F>
+                void for_each(F&& visit) noexcept {
+                    std::lock_guard<std::mutex> guard(_lock);
+                    for (auto cache = _caches; cache != nullptr; cache = cache->nextCache) {
+                        visit(*cache);
+                    }
+                }
+            };
+
+            inline CacheRegistry& __cache_registry() noexcept {
+                static typename std::aligned_storage<sizeof(CacheRegistry), alignof(CacheRegistry)>::type storage;
+                static CacheRegistry* registry = new (&storage) CacheRegistry();
+                return *registry;
+            }
+
+            ///-------------------------------------------------------------------------------------
+            ///
+            /// Statistics recording.
+            ///
+            ///-------------------------------------------------------------------------------------
+            /// The tag stamped on new blocks by the calling thread, see `mem::TagScope`.
+            inline uint16& __tls_tag() noexcept {
+                thread_local uint16 tag = 0;
+                return tag;
+            }
+
+            /// Counters of threads whose cache is already gone; shared, so updated atomically.
+            inline ThreadStats& __orphan_stats() noexcept {
+                static typename std::aligned_storage<sizeof(ThreadStats), alignof(ThreadStats)>::type storage;
+                static ThreadStats* stats = new (&storage) ThreadStats();
+                return *stats;
+            }
+
+            /// The bytes a block of `bucket` counts for; `bytes` is only read for large and huge blocks.
+            inline usize __bucket_bytes(uint32 bucket, usize bytes) noexcept {
+                return bucket < kSizeClassCount ? __class_to_size(bucket) : bytes;
+            }
+
+            /// Record a block of a thread without a cache; shared, so atomic and kept out of the hot path.
+            GLX_COLD inline void __record_orphan(uint32 bucket, uint16 tag, usize bytes, bool allocating) noexcept {
+                auto& stats = __orphan_stats();
+                auto  size  = __bucket_bytes(bucket, bytes);
+                (allocating ? stats.allocations : stats.frees)[bucket].add_shared(1);
+                if (bucket >= kLargeClass) {
+                    (allocating ? stats.allocatedBytes : stats.freedBytes)[bucket].add_shared(size);
+                }
+                if (tag != 0) {
+                    (allocating ? stats.tagAllocations : stats.tagFrees)[tag].add_shared(1);
+                    (allocating ? stats.tagAllocatedBytes : stats.tagFreedBytes)[tag].add_shared(size);
+                }
+                __publish_live(allocating ? int64(size) : -int64(size));
+            }
+
+            /// The rare part of recording: large and huge blocks, and tagged blocks.
+            GLX_COLD inline void __record_slow(ThreadCache& cache, uint32 bucket, uint16 tag, usize bytes, bool allocating) noexcept {
+                auto& stats = cache.stats;
+                auto  size  = __bucket_bytes(bucket, bytes);
+                if (tag != 0) {
+                    (allocating ? stats.tagAllocations : stats.tagFrees)[tag].add(1);
+                    (allocating ? stats.tagAllocatedBytes : stats.tagFreedBytes)[tag].add(size);
+                }
+                if (bucket >= kLargeClass) {
+                    (allocating ? stats.allocations : stats.frees)[bucket].add(1);
+                    (allocating ? stats.allocatedBytes : stats.freedBytes)[bucket].add(size);
+                    cache.publish(bucket);
+                }
+            }
+
+            /// Small blocks are counted by the free lists, and their bytes follow from the size class. Tag 0 is the 
+            /// remainder of the totals, so untagged small blocks record nothing here. `bytes` is only read for 
+            /// large and huge blocks.
+            inline void __record_allocate(ThreadCache* cache, uint32 bucket, uint16 tag, usize bytes) noexcept {
+#if GLX_MEM_STATS
+                if (cache == nullptr) {
+                    __record_orphan(bucket, tag, bytes, true);
+                } else if (bucket >= kLargeClass || tag != 0) {
+                    __record_slow(*cache, bucket, tag, bytes, true);
+                }
+#else
+                (void)cache, (void)bucket, (void)tag, (void)bytes;
+#endif
+            }
+
+            inline void __record_free(ThreadCache* cache, uint32 bucket, uint16 tag, usize bytes) noexcept {
+#if GLX_MEM_STATS
+                if (cache == nullptr) {
+                    __record_orphan(bucket, tag, bytes, false);
+                } else if (bucket >= kLargeClass || tag != 0) {
+                    __record_slow(*cache, bucket, tag, bytes, false);
+                }
+#else
+                (void)cache, (void)bucket, (void)tag, (void)bytes;
+#endif
+            }
+
+            enum ThreadCacheState : uint8 {
+                kCacheUnbound = 0,
+                kCacheBound   = 1,
+                kCacheExited  = 2,
+            };
+
+            /// Both thread-locals are trivially destructible, so they stay readable while other 
+            /// thread-local destructors run and free memory after the cache has been released.
+            inline ThreadCache*& __tls_cache() noexcept {
+                thread_local ThreadCache* cache = nullptr;
+                return cache;
+            }
+
+            inline uint8& __tls_cache_state() noexcept {
+                thread_local uint8 state = kCacheUnbound;
+                return state;
+            }
+
+            struct ThreadCacheReaper {
+                ~ThreadCacheReaper() noexcept {
+                    auto cache = __tls_cache();
+                    __tls_cache() = nullptr;
+                    __tls_cache_state() = kCacheExited;
+                    if (cache != nullptr) {
+#if GLX_MEM_STATS
+                        cache->publish_all();
+#endif
+                        __cache_registry().release(cache);
+                    }
+                }
+            };
+
+            /// Return the cache of the calling thread, or nullptr once the thread is shutting down.
+            inline ThreadCache* __thread_cache() noexcept {
+                auto cache = __tls_cache();
+                if (cache != nullptr) {
+                    return cache;
+                }
+                if (__tls_cache_state() != kCacheUnbound) {
+                    return nullptr;
+                }
+                thread_local ThreadCacheReaper reaper;
+                (void)reaper;
+                cache = __cache_registry().acquire();
+                __tls_cache() = cache;
+                __tls_cache_state() = cache != nullptr ? kCacheBound : kCacheExited;
+                return cache;
+            }
+
+            ///-------------------------------------------------------------------------------------
+            ///
+            /// Memory budgets.
+            ///
+            ///-------------------------------------------------------------------------------------
+            /// Called on the allocating thread when a budget first reaches its soft limit, see `mem::set_budget`.
+            using PressureCallback = void (*)(uint16 tag, usize usedBytes, void* context);
+
+            /// The bytes charged to one tag and its limits. Each sits on its own cache line, since every thread
+            /// allocating under the tag updates `used`.
+            struct alignas(kCacheLineBytes) Budget {
+                std::atomic<int64> used{ 0 };
+                std::atomic<int64> limit{ INT64_MAX };
+                std::atomic<int64> soft{ INT64_MAX };
+                std::atomic<bool>  pressed{ false };    /// Set from reaching the soft limit until falling back below it.
+                PressureCallback   callback = nullptr;  /// Guarded by `BudgetTable::lock`, like `context`.
+                void*              context  = nullptr;
+            };
+
+            struct BudgetTable {
+                std::mutex lock;
+                Budget     budgets[kMaxTags];
+            };
+
+            inline BudgetTable& __budget_table() noexcept {
+                static typename std::aligned_storage<sizeof(BudgetTable), alignof(BudgetTable)>::type storage;
+                static BudgetTable* table = new (&storage) BudgetTable();
+                return *table;
+            }
+
+            /// One bit per tag whose blocks are charged. A bit is never cleared, so every block charged is also 
+            /// credited; lifting a budget only raises its limits. A plain static, so checking needs no guard.
+            inline std::atomic<uint64>& __budgeted_tags() noexcept {
+                static std::atomic<uint64> tags(0);
+                return tags;
+            }
+
+            inline bool __budgeted(uint16 tag) noexcept {
+                return tag != 0 && (__budgeted_tags().load(std::memory_order_relaxed) >> tag & 1) != 0;
+            }
+
+            /// Run the callback of `tag` outside the lock, so that it may free or allocate.
+            GLX_COLD inline void __budget_pressure(uint16 tag, int64 used) noexcept {
+                auto& table  = __budget_table();
+                auto& budget = table.budgets[tag];
+                if (budget.pressed.exchange(true, std::memory_order_acq_rel)) {
+                    return;
+                }
+                PressureCallback callback;
+                void*            context;
+                {
+                    std::lock_guard<std::mutex> guard(table.lock);
+                    callback = budget.callback;
+                    context  = budget.context;
+                }
+                if (callback != nullptr) {
+                    callback(tag, used > 0 ? usize(used) : 0, context);
+                }
+            }
+
+            /// Charge `bytes` to the budget of `tag`, returns false and charges nothing if that would pass the limit.
+            GLX_COLD inline bool __budget_charge(uint16 tag, usize bytes) noexcept {
+                auto& budget = __budget_table().budgets[tag];
+                auto  used   = budget.used.fetch_add(int64(bytes), std::memory_order_relaxed) + int64(bytes);
+                if (used > budget.limit.load(std::memory_order_relaxed)) {
+                    used = budget.used.fetch_sub(int64(bytes), std::memory_order_relaxed) - int64(bytes);
+                    __budget_pressure(tag, used);
+                    return false;
+                }
+                if (used >= budget.soft.load(std::memory_order_relaxed) && !budget.pressed.load(std::memory_order_relaxed)) {
+                    __budget_pressure(tag, used);
+                }
+                return true;
+            }
+
+            /// Give `bytes` back to the budget of `tag`, and rearm its callback once below the soft limit.
+            GLX_COLD inline void __budget_credit(uint16 tag, usize bytes) noexcept {
+                auto& budget = __budget_table().budgets[tag];
+                auto  used   = budget.used.fetch_sub(int64(bytes), std::memory_order_relaxed) - int64(bytes);
+                if (used < budget.soft.load(std::memory_order_relaxed) && budget.pressed.load(std::memory_order_relaxed)) {
+                    budget.pressed.store(false, std::memory_order_release);
+                }
+            }
+
+            /// A block of `tag` grew or shrank from `from` to `to` bytes; returns false and changes nothing if growing
+            /// would pass the limit.
+            inline bool __budget_resize(uint16 tag, usize from, usize to) noexcept {
+                if (!__budgeted(tag) || from == to) {
+                    return true;
+                }
+                if (to > from) {
+                    return __budget_charge(tag, to - from);
+                }
+                __budget_credit(tag, from - to);
+                return true;
+            }
+
+            ///-------------------------------------------------------------------------------------
+            ///
+            /// Heap sampling.
+            ///
+            ///-------------------------------------------------------------------------------------
+            constexpr usize  kSampleFrames      = 32;
+            constexpr usize  kSampleStackBuckets = 4096;
+            constexpr usize  kSampleLiveBuckets  = 16384;
+            constexpr int64  kSampleRecheckBytes = 1024 * 1024;
+
+            /// A distinct stack that allocated sampled blocks, with raw sample counts as the pprof heap format wants.
+            struct SampleStack {
+                SampleStack* next;
+                uint64       hash;
+                uint32       depth;
+                void*        frames[kSampleFrames];
+                uint64       allocations;
+                uint64       allocatedBytes;
+                uint64       liveCount;
+                uint64       liveBytes;
+            };
+
+            /// A sampled block that is not freed yet.
+            struct LiveSample {
+                LiveSample*  next;
+                void*        ptr;
+                usize        bytes;
+                SampleStack* stack;
+            };
+
+            ///
+            /// `HeapSampler` keeps the stacks of sampled blocks and the sampled blocks still alive. It allocates
+            /// its own nodes with `malloc`, so recording a sample never reenters the pool.
+            /// @author ZhangKeyangZzz
+            ///
+            class HeapSampler {
+                std::mutex   _lock;
+                SampleStack* _stacks[kSampleStackBuckets] = {};
+                LiveSample*  _live[kSampleLiveBuckets] = {};
+
+            public:
+                std::atomic<bool>  enabled{ false };
+                std::atomic<usize> interval{ 512 * 1024 };
+
+            public:
+                void record_allocate(void* ptr, usize bytes, void* const* frames, uint32 depth) noexcept {
+                    auto hash = uint64(depth) * 0x9E3779B97F4A7C15ull;
+                    for (uint32 i = 0; i < depth; i++) {
+                        hash = (hash ^ uint64(reinterpret_cast<uintptr_t>(frames[i]))) * 0x100000001B3ull;
+                    }
+                    auto sample = reinterpret_cast<LiveSample*>(std::malloc(sizeof(LiveSample)));
+                    if (sample == nullptr) {
+                        return;
+                    }
+                    std::lock_guard<std::mutex> guard(_lock);
+                    auto& bucket = _stacks[hash % kSampleStackBuckets];
+                    auto  stack  = bucket;
+                    while (stack != nullptr && (stack->hash != hash || stack->depth != depth 
+                            || std::memcmp(stack->frames, frames, depth * sizeof(void*)) != 0)) {
+                        stack = stack->next;
+                    }
+                    if (stack == nullptr) {
+                        stack = reinterpret_cast<SampleStack*>(std::calloc(1, sizeof(SampleStack)));
+                        if (stack == nullptr) {
+                            std::free(sample);
+                            return;
+                        }
+                        stack->hash  = hash;
+                        stack->depth = depth;
+                        std::memcpy(stack->frames, frames, depth * sizeof(void*));
+                        stack->next = bucket;
+                        bucket = stack;
+                    }
+                    stack->allocations++;
+                    stack->allocatedBytes += bytes;
+                    stack->liveCount++;
+                    stack->liveBytes += bytes;
+                    auto& live = _live[__live_slot(ptr)];
+                    sample->next  = live;
+                    sample->ptr   = ptr;
+                    sample->bytes = bytes;
+                    sample->stack = stack;
+                    live = sample;
+                }
+
+                void record_free(void* ptr) noexcept {
+                    LiveSample* sample = nullptr;
+                    {
+                        std::lock_guard<std::mutex> guard(_lock);
+                        for (auto link = &_live[__live_slot(ptr)]; *link != nullptr; link = &(*link)->next) {
+                            if ((*link)->ptr == ptr) {
+                                sample = *link;
+                                *link = sample->next;
+                                sample->stack->liveCount--;
+                                sample->stack->liveBytes -= sample->bytes;
+                                break;
+                            }
+                        }
+                    }
+                    std::free(sample);
+                }
+
+                /// Call `visit(stack)` for every stack, under the lock.
+                template <typename F>
+                void for_each_stack(F&& visit) noexcept {
+                    std::lock_guard<std::mutex> guard(_lock);
+                    for (auto bucket : _stacks) {
+                        for (auto stack = bucket; stack != nullptr; stack = stack->next) {
+                            visit(*stack);
+                        }
+                    }
+                }
+
+            private:
+                static usize __live_slot(void* ptr) noexcept {
+                    return usize((uint64(reinterpret_cast<uintptr_t>(ptr)) * 0x9E3779B97F4A7C15ull) >> 50) % kSampleLiveBuckets;
+                }
+            };
+
+            inline HeapSampler& __heap_sampler() noexcept {
+                static typename std::aligned_storage<sizeof(HeapSampler), alignof(HeapSampler)>::type storage;
+                static HeapSampler* sampler = new (&storage) HeapSampler();
+                return *sampler;
+            }
+
+            /// Bytes the calling thread may still allocate before the next sample. It starts at 0, so the first 
+            /// allocation of a thread looks at the switch; while stopped it looks again every `kSampleRecheckBytes`.
+            inline int64& __tls_sample_countdown() noexcept {
+                thread_local int64 countdown = 0;
+                return countdown;
+            }
+
+            /// Whether the calling thread is inside the sampler, where a nested sample must not be taken.
+            inline bool& __tls_sampling() noexcept {
+                thread_local bool sampling = false;
+                return sampling;
+            }
+
+            /// Sampled small blocks carry this owner, so their free leaves the fast path.
+            inline ThreadCache* __sampled_owner() noexcept {
+                return reinterpret_cast<ThreadCache*>(uintptr_t(1));
+            }
+
+            /// Draw the distance to the next sample from an exponential distribution of mean `interval`, so every
+            /// byte is equally likely to be sampled wherever the allocation boundaries fall.
+            inline int64 __next_sample_distance(usize interval) noexcept {
+                thread_local uint64 state = uint64(reinterpret_cast<uintptr_t>(&state)) | 1;
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                auto uniform = (double(state >> 11) + 1.0) * (1.0 / 9007199254740993.0);
+                auto distance = -std::log(uniform) * double(interval);
+                return distance < 1.0 ? 1 : distance > 9e18 ? int64(9e18) : int64(distance);
+            }
+
+            /// The countdown ran out: reload it and, if profiling, record the block with the stack that allocated it.
+            GLX_COLD inline void __sample_allocation(void* block, usize bytes) noexcept {
+                auto& sampler = __heap_sampler();
+                auto& countdown = __tls_sample_countdown();
+                if (!sampler.enabled.load(std::memory_order_relaxed)) {
+                    countdown = kSampleRecheckBytes;
+                    return;
+                }
+                countdown = __next_sample_distance(sampler.interval.load(std::memory_order_relaxed));
+                if (block == nullptr || __tls_sampling()) {
+                    return;
+                }
+                __tls_sampling() = true;
+                void*  frames[kSampleFrames + 1];
+                uint32 depth = 0;
+#if defined(__GLIBC__)
+                depth = uint32(::backtrace(frames, int(kSampleFrames + 1)));
+#endif
+                auto skip = depth > 0 ? 1u : 0u;
+                sampler.record_allocate(block, bytes, frames + skip, depth - skip);
+                auto header = __header_of(block);
+                if (header->sizeClass < kLargeClass) {
+                    header->owner = __sampled_owner();
+                } else {
+                    header->sizeClass = uint16(header->sizeClass | kSampledFlag);
+                }
+                __tls_sampling() = false;
+            }
+
+            /// Charge `bytes` to the countdown of the calling thread; one predictable branch while profiling is off.
+            inline void __sample_point(void* block, usize bytes) noexcept {
+#if GLX_MEM_PROFILE
+                auto& countdown = __tls_sample_countdown();
+                countdown -= int64(bytes);
+                if (countdown < 0) {
+                    __sample_allocation(block, bytes);
+                }
+#else
+                (void)block, (void)bytes;
+#endif
+            }
+
+            /// A sampled block is freed; also called when a sampled block is resized, which ends its sample.
+            GLX_COLD inline void __sample_free(void* block) noexcept {
+                auto header = __header_of(block);
+                if (header->sizeClass & kSampledFlag) {
+                    header->sizeClass = uint16(header->sizeClass & ~kSampledFlag);
+                } else {
+                    header->owner = nullptr;
+                }
+                __heap_sampler().record_free(block);
+            }
+
+            ///-------------------------------------------------------------------------------------
+            ///
+            /// Allocation tracing.
+            ///
+            ///-------------------------------------------------------------------------------------
+            /// One call of the trace file, see `mem::start_trace`.
+            struct TraceRecord {
+                uint64 time;        /// Nanoseconds since the trace started.
+                uint64 address;     /// The block; a free belongs to the latest allocation of the same address.
+                uint64 bytes;       /// The requested bytes of an allocation, 0 for a free.
+                uint32 thread;      /// The recording thread, numbered from 1 in the order threads first allocated.
+                uint32 kind;        /// `kTraceAllocate` or `kTraceFree`.
+            };
+
+            /// The trace file starts with this header, then holds records until its end.
+            struct TraceHeader {
+                char   magic[8];    /// "GLXTRACE"
+                uint32 version;
+                uint32 recordBytes;
+            };
+
+            constexpr uint32 kTraceAllocate      = 0;
+            constexpr uint32 kTraceFree          = 1;
+            constexpr uint32 kTraceVersion       = 1;
+            constexpr usize  kTraceBufferRecords = 2048;
+            static_assert(sizeof(TraceRecord) == 32, "TraceRecord is a file format.");
+
+            ///
+            /// `TraceBuffer` collects the records of one thread. The owner sets `busy` around each append; whoever 
+            /// stops the trace waits for it to clear and writes out the rest, so appending never takes a lock.
+            /// @author ZhangKeyangZzz
+            ///
+            struct TraceBuffer {
+                std::atomic<bool> busy{ false };
+                uint32            thread   = 0;
+                uint32            used     = 0;
+                TraceBuffer*      next     = nullptr;   /// Link in the list of every buffer ever created.
+                TraceBuffer*      nextIdle = nullptr;   /// Link in the list of buffers without a thread.
+                TraceRecord       records[kTraceBufferRecords];
+            };
+
+            /// The switch is a plain static so that checking it needs no initialization guard.
+            inline std::atomic<bool>& __trace_enabled() noexcept {
+                static std::atomic<bool> enabled(false);
+                return enabled;
+            }
+
+            class TraceSession {
+                std::mutex   _lock;
+                TraceBuffer* _buffers = nullptr;
+                TraceBuffer* _idle    = nullptr;
+                uint32       _threads = 0;
+
+            public:
+                std::mutex          control;    /// Serializes starting and stopping.
+                std::atomic<int>    fd{ -1 };
+                std::atomic<uint64> start{ 0 };
+
+            public:
+                /// Bind a buffer to the calling thread, reusing one left behind by an exited thread if possible.
+                TraceBuffer* acquire() noexcept {
+                    std::lock_guard<std::mutex> guard(_lock);
+                    auto buffer = _idle;
+                    if (buffer != nullptr) {
+                        _idle = buffer->nextIdle;
+                        buffer->nextIdle = nullptr;
+                    } else {
+                        auto storage = std::malloc(sizeof(TraceBuffer));
+                        if (storage == nullptr) {
+                            return nullptr;
+                        }
+                        buffer = new (storage) TraceBuffer();
+                        buffer->next = _buffers;
+                        _buffers = buffer;
+                    }
+                    buffer->thread = ++_threads;
+                    return buffer;
+                }
+
+                /// Called when the owning thread exits.
+                void release(TraceBuffer* buffer) noexcept {
+                    buffer->busy.store(true);
+                    if (__trace_enabled().load()) {
+                        flush(*buffer);
+                    }
+                    buffer->busy.store(false, std::memory_order_release);
+                    std::lock_guard<std::mutex> guard(_lock);
+                    buffer->nextIdle = _idle;
+                    _idle = buffer;
+                }
+
+                /// Append the records of `buffer` to the file with one `write`, which the kernel keeps whole.
+                void flush(TraceBuffer& buffer) noexcept {
+#if defined(__linux__)
+                    auto file = fd.load(std::memory_order_relaxed);
+                    if (file >= 0 && buffer.used > 0) {
+                        auto written = ::write(file, buffer.records, buffer.used * sizeof(TraceRecord));
+                        (void)written;
+                    }
+#endif
+                    buffer.used = 0;
+                }
+
+                /// Write out every buffer once no thread is appending; called after the switch is off.
+                void drain() noexcept {
+                    std::lock_guard<std::mutex> guard(_lock);
+                    for (auto buffer = _buffers; buffer != nullptr; buffer = buffer->next) {
+                        while (buffer->busy.load(std::memory_order_acquire)) {
+                            std::this_thread::yield();
+                        }
+                        flush(*buffer);
+                    }
+                }
+            };
+
+            inline TraceSession& __trace_session() noexcept {
+                static typename std::aligned_storage<sizeof(TraceSession), alignof(TraceSession)>::type storage;
+                static TraceSession* session = new (&storage) TraceSession();
+                return *session;
+            }
+
+            inline uint64 __trace_clock() noexcept {
+                auto now = std::chrono::steady_clock::now().time_since_epoch();
+                return uint64(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+            }
+
+            /// Trivially destructible, so they stay readable while other thread-local destructors run.
+            inline TraceBuffer*& __tls_trace_buffer() noexcept {
+                thread_local TraceBuffer* buffer = nullptr;
+                return buffer;
+            }
+
+            inline uint8& __tls_trace_state() noexcept {
+                thread_local uint8 state = kCacheUnbound;
+                return state;
+            }
+
+            struct TraceBufferReaper {
+                ~TraceBufferReaper() noexcept {
+                    auto buffer = __tls_trace_buffer();
+                    __tls_trace_buffer() = nullptr;
+                    __tls_trace_state() = kCacheExited;
+                    if (buffer != nullptr) {
+                        __trace_session().release(buffer);
+                    }
+                }
+            };
+
+            /// Return the buffer of the calling thread, or nullptr once the thread is shutting down.
+            inline TraceBuffer* __trace_thread_buffer() noexcept {
+                auto buffer = __tls_trace_buffer();
+                if (buffer != nullptr || __tls_trace_state() != kCacheUnbound) {
+                    return buffer;
+                }
+                thread_local TraceBufferReaper reaper;
+                (void)reaper;
+                buffer = __trace_session().acquire();
+                __tls_trace_buffer() = buffer;
+                __tls_trace_state() = buffer != nullptr ? kCacheBound : kCacheExited;
+                return buffer;
+            }
+
+            /// Append one record. Setting `busy` and then checking the switch, both sequentially consistent, pairs
+            /// with `drain`: either the stopping thread sees the buffer busy and waits, or this thread sees the
+            /// trace stopped and appends nothing.
+            GLX_COLD inline void __trace_record(void* block, usize bytes, uint32 kind) noexcept {
+                auto buffer = __trace_thread_buffer();
+                if (buffer == nullptr) {
+                    return;
+                }
+                buffer->busy.store(true);
+                if (__trace_enabled().load()) {
+                    auto& session = __trace_session();
+                    auto& record  = buffer->records[buffer->used++];
+                    record.time    = __trace_clock() - session.start.load(std::memory_order_relaxed);
+                    record.address = uint64(reinterpret_cast<uintptr_t>(block));
+                    record.bytes   = bytes;
+                    record.thread  = buffer->thread;
+                    record.kind    = kind;
+                    if (buffer->used == kTraceBufferRecords) {
+                        session.flush(*buffer);
+                    }
+                }
+                buffer->busy.store(false, std::memory_order_release);
+            }
+
+            inline void __trace_point(void* block, usize bytes, uint32 kind) noexcept {
+#if GLX_MEM_TRACE
+                if (__trace_enabled().load(std::memory_order_relaxed) && block != nullptr) {
+                    __trace_record(block, bytes, kind);
+                }
+#else
+                (void)block, (void)bytes, (void)kind;
+#endif
+            }
+
+            /// Everything that watches allocations: the trace and the heap sampler.
+            inline void* __observe_allocation(void* block, usize bytes) noexcept {
+                __trace_point(block, bytes, kTraceAllocate);
+                __sample_point(block, bytes);
+                return block;
+            }
+
+            ///-------------------------------------------------------------------------------------
+            ///
+            /// Large and mapped blocks.
+            ///
+            ///-------------------------------------------------------------------------------------
+            inline std::atomic<usize>& __map_threshold() noexcept {
+                static std::atomic<usize> threshold(kDefaultMapThreshold);
+                return threshold;
+            }
+
+            inline usize __page_bytes() noexcept {
+#if defined(__linux__)
+                static usize bytes = usize(::sysconf(_SC_PAGESIZE));
+                return bytes;
+#else
+                return 4096;
+#endif
+            }
+
+            /// The length of the mapping that holds a header and `bytes` bytes, 0 if it overflows.
+            inline usize __map_length(usize bytes) noexcept {
+                auto page = __page_bytes();
+                if (bytes > usize(-1) - kBlockHeaderBytes - page) {
+                    return 0;
+                }
+                return (kBlockHeaderBytes + bytes + page - 1) & ~(page - 1);
+            }
+
+            /// Allocate more than `kMaxSmallBytes` bytes from the system heap, or from a fresh mapping at or above 
+            /// the map threshold. A mapped block is counted as a large block of its whole mapping.
+            /// With `zeroed`, the heap block comes from `calloc`, which skips clearing memory fresh from the system;
+            /// a fresh mapping is zero anyway.
+            inline void* __large_allocate(ThreadCache* cache, uint16 tag, usize bytes, bool zeroed = false) noexcept {
+                if (bytes > usize(-1) - kBlockHeaderBytes) {
+                    return nullptr;
+                }
+                BlockHeader* header;
+#if defined(__linux__)
+                if (bytes >= __map_threshold().load(std::memory_order_relaxed)) {
+                    auto length = __map_length(bytes);
+                    if (length == 0 || (__budgeted(tag) && !__budget_charge(tag, length))) {
+                        return nullptr;
+                    }
+                    auto mapped = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                    if (mapped == MAP_FAILED) {
+                        __budget_resize(tag, length, 0);
+                        return nullptr;
+                    }
+                    header = reinterpret_cast<BlockHeader*>(mapped);
+                    header->sizeClass = uint16(kMappedClass);
+                    header->tag       = tag;
+                    header->offset    = 0;
+                    header->bytes     = length;
+                    __record_allocate(cache, kLargeClass, tag, length);
+                    return header + 1;
+                }
+#endif
+                if (__budgeted(tag) && !__budget_charge(tag, bytes)) {
+                    return nullptr;
+                }
+                header = reinterpret_cast<BlockHeader*>(zeroed
+                    ? std::calloc(1, kBlockHeaderBytes + bytes)
+                    : std::malloc(kBlockHeaderBytes + bytes));
+                if (header == nullptr) {
+                    __budget_resize(tag, bytes, 0);
+                    return nullptr;
+                }
+                header->sizeClass = uint16(kLargeClass);
+                header->tag       = tag;
+                header->offset    = 0;
+                header->bytes     = bytes;
+                __record_allocate(cache, kLargeClass, tag, bytes);
+                return header + 1;
+            }
+
+            /// Allocate `bytes` bytes, returns nullptr if the system is out of memory.
+            inline void* __pool_allocate(usize bytes) noexcept {
+                auto cache = __thread_cache();
+                auto tag   = __tls_tag();
+                if (bytes > kMaxSmallBytes) {
+                    return __observe_allocation(__large_allocate(cache, tag, bytes), bytes);
+                }
+                auto sizeClass = __size_to_class(bytes);
+                if (__budgeted(tag) && !__budget_charge(tag, __class_to_size(sizeClass))) {
+                    return nullptr;
+                }
+                void* block;
+                if (cache != nullptr) {
+                    block = cache->allocate(sizeClass);
+                } else {
+                    void*  head;
+                    uint32 length;
+                    if (!__central_cache().pop(sizeClass, head, length)) {
+                        __budget_resize(tag, __class_to_size(sizeClass), 0);
+                        return nullptr;
+                    }
+                    if (length > 1) {
+                        auto rest = __next_of(head);
+                        __next_of(head) = nullptr;
+                        __central_cache().push(sizeClass, rest, length - 1);
+                    }
+                    block = head;
+                }
+                if (block != nullptr) {
+                    __header_of(block)->owner = cache;
+                    __header_of(block)->tag   = tag;
+                    __record_allocate(cache, sizeClass, tag, bytes);
+                } else {
+                    __budget_resize(tag, __class_to_size(sizeClass), 0);
+                }
+                return __observe_allocation(block, bytes);
+            }
+
+            /// Allocate `bytes` bytes aligned to `align`, which must be a power of two.
+            /// The block is carved from an ordinary block that is `align` bytes larger, and its header records the way back.
+            inline void* __aligned_allocate(usize bytes, usize align) noexcept {
+                if (align <= kBlockHeaderBytes) {
+                    return __pool_allocate(bytes);
+                }
+                if (align > kHugePageBytes || bytes > usize(-1) - align) {
+                    return nullptr;
+                }
+                auto raw = reinterpret_cast<byte*>(__pool_allocate(bytes + align));
+                if (raw == nullptr) {
+                    return nullptr;
+                }
+                auto address = (reinterpret_cast<uintptr_t>(raw) + kBlockHeaderBytes + align - 1) & ~uintptr_t(align - 1);
+                auto ptr     = reinterpret_cast<void*>(address);
+                auto header  = __header_of(ptr);
+                header->sizeClass = uint16(kAlignedClass);
+                header->tag       = __header_of(raw)->tag;
+                header->offset    = uint32(reinterpret_cast<byte*>(ptr) - raw);
+                header->bytes     = bytes;
+                return ptr;
+            }
+
+            /// Allocate `bytes` bytes from a fresh mapping aligned to `kHugePageBytes` and advised to be backed by
+            /// transparent huge pages. The user pointer is one cache line past the start of the mapping.
+            inline void* __huge_allocate(usize bytes) noexcept {
+#if defined(__linux__)
+                if (bytes > usize(-1) - 2 * kHugePageBytes) {
+                    return nullptr;
+                }
+                auto length = (bytes + kCacheLineBytes + kHugePageBytes - 1) & ~(kHugePageBytes - 1);
+                auto tag    = __tls_tag();
+                if (__budgeted(tag) && !__budget_charge(tag, length)) {
+                    return nullptr;
+                }
+                auto mapped = ::mmap(nullptr, length + kHugePageBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (mapped == MAP_FAILED) {
+                    __budget_resize(tag, length, 0);
+                    return nullptr;
+                }
+                auto start = reinterpret_cast<uintptr_t>(mapped);
+                auto base  = (start + kHugePageBytes - 1) & ~uintptr_t(kHugePageBytes - 1);
+                if (base > start) {
+                    ::munmap(mapped, base - start);
+                }
+                ::munmap(reinterpret_cast<void*>(base + length), start + kHugePageBytes - base);
+#if defined(MADV_HUGEPAGE)
+                ::madvise(reinterpret_cast<void*>(base), length, MADV_HUGEPAGE);
+#endif
+                auto ptr    = reinterpret_cast<void*>(base + kCacheLineBytes);
+                auto header = __header_of(ptr);
+                header->sizeClass = uint16(kHugeClass);
+                header->tag       = tag;
+                header->offset    = uint32(kCacheLineBytes);
+                header->bytes     = length;
+                __record_allocate(__thread_cache(), kHugeClass, tag, length);
+                return ptr;
+#else
+                return __aligned_allocate(bytes, kCacheLineBytes);
+#endif
+            }
+
+            /// Allocate `bytes` bytes on the pages of `node`, as a mapped block so that any free or resize handles it.
+            /// A single-node machine, or a system without mappings, allocates from the pool instead.
+            inline void* __node_allocate(usize bytes, uint32 node) noexcept {
+#if defined(__linux__)
+                if (__numa_node_count() > 1) {
+                    auto length = __map_length(bytes);
+                    auto tag    = __tls_tag();
+                    if (length == 0 || (__budgeted(tag) && !__budget_charge(tag, length))) {
+                        return nullptr;
+                    }
+                    auto header = reinterpret_cast<BlockHeader*>(__node_pages(length, node));
+                    if (header == nullptr) {
+                        __budget_resize(tag, length, 0);
+                        return nullptr;
+                    }
+                    header->sizeClass = uint16(kMappedClass);
+                    header->tag       = tag;
+                    header->offset    = 0;
+                    header->bytes     = length;
+                    __record_allocate(__thread_cache(), kLargeClass, tag, length);
+                    return __observe_allocation(header + 1, bytes);
+                }
+#endif
+                (void)node;
+                return __pool_allocate(bytes);
+            }
+
+            /// Allocate `bytes` zero bytes aligned to `align`. Only recycled memory is cleared: large blocks come from
+            /// `calloc` or a fresh mapping, which are zero already.
+            inline void* __zeroed_allocate(usize bytes, usize align) noexcept {
+                if (bytes > kMaxSmallBytes && align <= kBlockHeaderBytes) {
+                    return __observe_allocation(__large_allocate(__thread_cache(), __tls_tag(), bytes, true), bytes);
+                }
+                auto ptr = __aligned_allocate(bytes, align);
+                if (ptr == nullptr) {
+                    return nullptr;
+                }
+                auto header = __header_of(ptr);
+                if (header->sizeClass == kAlignedClass) {
+                    header = __header_of(reinterpret_cast<byte*>(ptr) - header->offset);
+                }
+                if ((header->sizeClass & ~kSampledFlag) != kMappedClass) {
+                    std::memset(ptr, 0, bytes);
+                }
+                return ptr;
+            }
+
+            inline void __pool_deallocate(void* ptr) noexcept;
+
+            /// Release an aligned, large or huge block. Kept apart so the small-block path stays short enough to inline.
+            inline void __special_deallocate(void* ptr) noexcept {
+                auto header = __header_of(ptr);
+                if (header->sizeClass & kSampledFlag) {
+                    __sample_free(ptr);
+                }
+                if (header->sizeClass == kAlignedClass) {
+                    __pool_deallocate(reinterpret_cast<byte*>(ptr) - header->offset);
+                    return;
+                }
+                auto cache = __thread_cache();
+                if (header->sizeClass != kHugeClass) {
+                    __trace_point(ptr, 0, kTraceFree);
+                }
+                __budget_resize(header->tag, header->bytes, 0);
+                if (header->sizeClass == kLargeClass) {
+                    __record_free(cache, kLargeClass, header->tag, header->bytes);
+                    std::free(header);
+                    return;
+                }
+#if defined(__linux__)
+                if (header->sizeClass == kMappedClass) {
+                    __record_free(cache, kLargeClass, header->tag, header->bytes);
+                    ::munmap(header, header->bytes);
+                    return;
+                }
+                __record_free(cache, kHugeClass, header->tag, header->bytes);
+                ::munmap(reinterpret_cast<byte*>(ptr) - header->offset, header->bytes);
+#endif
+            }
+
+            /// Free a small block allocated by another cache: hand it back to its owner, or keep it if the owner
+            /// is gone. Producer/consumer pipelines thus return memory to the producer instead of piling it up
+            /// at the consumer and going through the central cache.
+            inline void __remote_deallocate(ThreadCache* cache, uint32 sizeClass, void* ptr) noexcept {
+                auto owner = __header_of(ptr)->owner;
+                if (owner == __sampled_owner()) {
+                    __sample_free(ptr);
+                    owner = nullptr;
+                }
+                if (owner != nullptr && owner->push_remote(sizeClass, ptr)) {
+#if GLX_MEM_STATS
+                    if (cache != nullptr) {
+                        cache->count_free(sizeClass);
+                    }
+#endif
+                    return;
+                }
+                if (cache != nullptr) {
+                    cache->deallocate(sizeClass, ptr);
+                } else {
+                    __next_of(ptr) = nullptr;
+                    __central_cache().push(sizeClass, ptr, 1);
+                }
+            }
+
+            /// Release a block returned by `__pool_allocate`, `__aligned_allocate` or `__huge_allocate`.
+            inline void __pool_deallocate(void* ptr) noexcept {
+                auto header = __header_of(ptr);
+                if (header->sizeClass >= kLargeClass) {
+                    __special_deallocate(ptr);
+                    return;
+                }
+                __trace_point(ptr, 0, kTraceFree);
+                auto cache     = __thread_cache();
+                auto sizeClass = uint32(header->sizeClass);
+                __record_free(cache, sizeClass, header->tag, 0);
+                if (__budgeted(header->tag)) {
+                    __budget_credit(header->tag, __class_to_size(sizeClass));
+                }
+                if (cache != nullptr && header->owner == cache) {
+                    cache->deallocate(sizeClass, ptr);
+                } else {
+                    __remote_deallocate(cache, sizeClass, ptr);
+                }
+            }
+
+            /// Release a block of `bytes` bytes returned by `__pool_allocate`. The size class follows from `bytes`,
+            /// so the free list is known without waiting on the header, which is only compared to the cache.
+            inline void __pool_deallocate_sized(void* ptr, usize bytes) noexcept {
+                if (bytes > kMaxSmallBytes) {
+                    __pool_deallocate(ptr);
+                    return;
+                }
+                __trace_point(ptr, 0, kTraceFree);
+                auto cache     = __thread_cache();
+                auto sizeClass = __size_to_class(bytes);
+                __record_free(cache, sizeClass, __header_of(ptr)->tag, 0);
+                if (__budgeted(__header_of(ptr)->tag)) {
+                    __budget_credit(__header_of(ptr)->tag, __class_to_size(sizeClass));
+                }
+                if (cache != nullptr && __header_of(ptr)->owner == cache) {
+                    cache->deallocate(sizeClass, ptr);
+                } else {
+                    __remote_deallocate(cache, sizeClass, ptr);
+                }
+            }
+
+            ///-------------------------------------------------------------------------------------
+            ///
+            /// Reallocation.
+            ///
+            ///-------------------------------------------------------------------------------------
+            /// A large or mapped block changed its size; the statistics see a free of the old block and an allocation
+            /// of the new one.
+            inline void __record_resize(BlockHeader* header, usize bytes) noexcept {
+                auto cache = __thread_cache();
+                __record_free(cache, kLargeClass, header->tag, header->bytes);
+                __record_allocate(cache, kLargeClass, header->tag, bytes);
+                header->bytes = bytes;
+            }
+
+            /// A resized block appears in the trace as a free of the old block and an allocation of the new one.
+            /// Aligned blocks are traced as the block they were carved from.
+            inline void __trace_resize(void* from, void* to, usize bytes) noexcept {
+#if GLX_MEM_TRACE
+                if (__trace_enabled().load(std::memory_order_relaxed)) {
+                    auto header = __header_of(to);
+                    if (header->sizeClass == kHugeClass) {
+                        return;
+                    }
+                    if (header->sizeClass == kAlignedClass) {
+                        from = reinterpret_cast<byte*>(from) - header->offset;
+                        to   = reinterpret_cast<byte*>(to) - header->offset;
+                    }
+                    __trace_record(from, 0, kTraceFree);
+                    __trace_record(to, bytes, kTraceAllocate);
+                }
+#else
+                (void)from, (void)to, (void)bytes;
+#endif
+            }
+
+            /// Make the block at `ptr` hold `bytes` bytes without moving it, returns false if it can't.
+            /// A block never changes between small and large, nor between size classes, so that a sized
+            /// `deallocate` with the new size still finds the right free list.
+            inline bool __try_resize(void* ptr, usize bytes) noexcept {
+                auto header = __header_of(ptr);
+                if (header->sizeClass & kSampledFlag) {
+                    __sample_free(ptr);
+                }
+                if (header->sizeClass < kLargeClass) {
+                    return bytes <= kMaxSmallBytes && __size_to_class(bytes) == header->sizeClass;
+                }
+                if (bytes <= kMaxSmallBytes) {
+                    return false;
+                }
+                switch (header->sizeClass) {
+                case kLargeClass:
+                    if (bytes > header->bytes) {
+                        return false;
+                    }
+                    __budget_resize(header->tag, header->bytes, bytes);
+                    __record_resize(header, bytes);
+                    return true;
+                case kAlignedClass:
+                    return bytes <= header->bytes;
+                case kHugeClass:
+                    return bytes <= header->bytes - header->offset;
+                default:
+                    break;
+                }
+#if defined(__linux__)
+                auto length = __map_length(bytes);
+                if (length == 0) {
+                    return false;
+                }
+                if (length < header->bytes) {
+                    ::munmap(reinterpret_cast<byte*>(header) + length, header->bytes - length);
+                    __budget_resize(header->tag, header->bytes, length);
+                } else if (length > header->bytes) {
+#if GLX_HAS_MREMAP
+                    if (!__budget_resize(header->tag, header->bytes, length)) {
+                        return false;
+                    }
+                    if (::mremap(header, header->bytes, length, 0) == MAP_FAILED) {
+                        __budget_resize(header->tag, length, header->bytes);
+                        return false;
+                    }
+#else
+                    return false;
+#endif
+                }
+                if (length != header->bytes) {
+                    __record_resize(header, length);
+                }
+                return true;
+#else
+                return false;
+#endif
+            }
+
+            inline bool __resize_in_place(void* ptr, usize bytes) noexcept {
+                if (!__try_resize(ptr, bytes)) {
+                    return false;
+                }
+                __trace_resize(ptr, ptr, bytes);
+                return true;
+            }
+
+            /// Resize a block holding trivially relocatable data, moving it if it can't stay. The first `keep` bytes
+            /// are preserved. Returns the block, or nullptr with the old block untouched if the memory is exhausted.
+            /// Mapped blocks are moved by `mremap` and heap blocks by `realloc`, neither of which copies the pages.
+            inline void* __pool_reallocate(void* ptr, usize keep, usize bytes, usize align) noexcept {
+                if (__resize_in_place(ptr, bytes)) {
+                    return ptr;
+                }
+                auto header = __header_of(ptr);
+                if (bytes > kMaxSmallBytes && header->sizeClass == kLargeClass && bytes < __map_threshold().load(std::memory_order_relaxed)) {
+                    if (bytes > usize(-1) - kBlockHeaderBytes) {
+                        return nullptr;
+                    }
+                    auto tag     = header->tag;
+                    auto oldSize = header->bytes;
+                    if (!__budget_resize(tag, oldSize, bytes)) {
+                        return nullptr;
+                    }
+                    auto moved = reinterpret_cast<BlockHeader*>(std::realloc(header, kBlockHeaderBytes + bytes));
+                    if (moved == nullptr) {
+                        __budget_resize(tag, bytes, oldSize);
+                        return nullptr;
+                    }
+                    auto cache = __thread_cache();
+                    __record_free(cache, kLargeClass, tag, oldSize);
+                    __record_allocate(cache, kLargeClass, tag, bytes);
+                    moved->bytes = bytes;
+                    __trace_resize(ptr, moved + 1, bytes);
+                    return moved + 1;
+                }
+#if GLX_HAS_MREMAP
+                if (bytes > kMaxSmallBytes && header->sizeClass == kMappedClass) {
+                    auto length = __map_length(bytes);
+                    if (length == 0 || !__budget_resize(header->tag, header->bytes, length)) {
+                        return nullptr;
+                    }
+                    auto mapped = ::mremap(header, header->bytes, length, MREMAP_MAYMOVE);
+                    if (mapped == MAP_FAILED) {
+                        __budget_resize(header->tag, length, header->bytes);
+                        return nullptr;
+                    }
+                    auto moved = reinterpret_cast<BlockHeader*>(mapped);
+                    auto cache = __thread_cache();
+                    __record_free(cache, kLargeClass, moved->tag, moved->bytes);
+                    __record_allocate(cache, kLargeClass, moved->tag, length);
+                    moved->bytes = length;
+                    __trace_resize(ptr, moved + 1, bytes);
+                    return moved + 1;
+                }
+#endif
+                auto block = __aligned_allocate(bytes, align);
+                if (block == nullptr) {
+                    return nullptr;
+                }
+                std::memcpy(block, ptr, keep < bytes ? keep : bytes);
+                __pool_deallocate(ptr);
+                return block;
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,208 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file provides the monotonic region allocator `mem::Arena`.
+ * 
+ * @file mem_arena.hpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#ifndef __GLX__CORE__MEM__ARENA__HPP__
+#define __GLX__CORE__MEM__ARENA__HPP__
+#include "mem_utilities.hpp"
+#include "Uncopyable.hpp"
+
+namespace glx {
+    namespace mem {
+        /**
+         * `Arena` hands out memory by bumping a pointer through a chain of blocks obtained from `allocate`.
+         * Nothing is freed one by one: `reset` rewinds the whole region in O(1) and keeps the blocks for reuse,
+         * `release` returns every block to the pool. An arena bound to a NUMA node takes its blocks from 
+         * `allocate_on_node`, so everything placed in it lives on that node.
+         * @author ZhangKeyangZzz
+         * @note The arena never runs destructors. Objects with non-trivial destructors must be destroyed by 
+         *       their owner (see `ArenaDeleter`) before the region is reset.
+         */
+        class Arena : public Uncopyable {
+            struct Block {
+                Block* next;
+                usize  capacity;
+            };
+            static_assert(sizeof(Block) == 16, "Block header must keep the payload 16-byte aligned.");
+
+            Block* _head    = nullptr;
+            Block* _current = nullptr;
+            byte*  _cursor  = nullptr;
+            byte*  _limit   = nullptr;
+            usize  _blockBytes;
+            uint32 _node;
+
+        public:
+            static constexpr usize  kDefaultBlockBytes = 64 * 1024;
+            static constexpr uint32 kAnyNode           = uint32(-1);
+
+            explicit Arena(usize blockBytes = kDefaultBlockBytes, uint32 node = kAnyNode) noexcept 
+                : _blockBytes(blockBytes), _node(node) {}
+            ~Arena() noexcept { release(); }
+
+        public:
+            /**
+             * Allocate `bytes` bytes aligned to `align` from the region.
+             * @param[in] bytes The requested bytes.
+             * @param[in] align The alignment, must be a power of two.
+             * @return Returns the address of the memory, or nullptr if the system is out of memory.
+             */
+            void* allocate_bytes(usize bytes, usize align = alignof(std::max_align_t)) noexcept {
+                auto ptr = _align_up(_cursor, align);
+                if (_cursor != nullptr && ptr <= _limit && usize(_limit - ptr) >= bytes) {
+                    _cursor = ptr + bytes;
+                    return ptr;
+                }
+                return _grow(bytes, align);
+            }
+
+            /**
+             * Allocate uninitialized memory for `count` elements of type `T`.
+             * @param[in] count The specified elements count.
+             * @tparam T The type of elements.
+             */
+            template <typename T>
+            T* allocate(usize count) noexcept {
+                if (count > usize(-1) / sizeof(T)) {
+                    return nullptr;
+                }
+                return reinterpret_cast<T*>(allocate_bytes(count * sizeof(T), alignof(T)));
+            }
+
+            /// Rewind the region to its first block. Every block is kept for the next round.
+            void reset() noexcept {
+                _current = _head;
+                _cursor  = _head != nullptr ? _payload(_head) : nullptr;
+                _limit   = _head != nullptr ? _cursor + _head->capacity : nullptr;
+            }
+
+            /// Return every block to the pool.
+            void release() noexcept {
+                while (_head != nullptr) {
+                    auto next = _head->next;
+                    if (_node == kAnyNode) {
+                        deallocate(_head, sizeof(Block) + _head->capacity);
+                    } else {
+                        deallocate(_head);
+                    }
+                    _head = next;
+                }
+                _current = nullptr;
+                _cursor  = nullptr;
+                _limit   = nullptr;
+            }
+
+            /// Return the total bytes of the blocks held by this arena.
+            usize capacity() const noexcept {
+                usize total = 0;
+                for (auto block = _head; block != nullptr; block = block->next) {
+                    total += block->capacity;
+                }
+                return total;
+            }
+
+        private:
+            static byte* _payload(Block* block) noexcept {
+                return reinterpret_cast<byte*>(block + 1);
+            }
+
+            static byte* _align_up(byte* ptr, usize align) noexcept {
+                auto address = reinterpret_cast<uintptr_t>(ptr);
+                return reinterpret_cast<byte*>((address + align - 1) & ~uintptr_t(align - 1));
+            }
+
+            /// Move to the next retained block, or chain a new one after the current block.
+            void* _grow(usize bytes, usize align) noexcept {
+                if (bytes > usize(-1) - align - sizeof(Block)) {
+                    return nullptr;
+                }
+                auto needed = bytes + align;
+                auto next   = _current != nullptr ? _current->next : _head;
+                auto block  = next;
+                if (block == nullptr || block->capacity < needed) {
+                    auto capacity = needed > _blockBytes ? needed : _blockBytes;
+                    block = reinterpret_cast<Block*>(_node == kAnyNode
+                          ? mem::allocate<byte>(sizeof(Block) + capacity)
+                          : mem::allocate_on_node<byte>(sizeof(Block) + capacity, _node));
+                    if (block == nullptr) {
+                        return nullptr;
+                    }
+                    block->next     = next;
+                    block->capacity = capacity;
+                    if (_current != nullptr) {
+                        _current->next = block;
+                    } else {
+                        _head = block;
+                    }
+                }
+                _current = block;
+                _limit   = _payload(block) + block->capacity;
+                auto ptr = _align_up(_payload(block), align);
+                _cursor  = ptr + bytes;
+                return ptr;
+            }
+        };
+
+        /**
+         * A deleter for objects placed in an `Arena`. It runs the destructor and leaves the memory to the region.
+         * @tparam T The type of object.
+         */
+        template <typename T>
+        struct ArenaDeleter {
+            void operator()(T const* ptr) { destruct(const_cast<T*>(ptr)); }
+        };
+
+        /// A `Unique` owning an object placed in an `Arena`. Destroying it never frees memory.
+        template <typename T>
+        using ArenaUnique = Unique<T, ArenaDeleter<T>>;
+
+        static_assert(sizeof(ArenaUnique<int>) == sizeof(int*), "ArenaUnique must be pointer-sized.");
+
+        /**
+         * Construct an object of type `T` in `arena` and wrap it into an `ArenaUnique`.
+         * @param[in] arena The arena holding the object.
+         * @param[in] args arguments to construct a object of type `T`
+         * @tparam T The type of object.
+         * @tparam Args The argument types.
+         */
+        template <typename T, typename... Args>
+        inline ArenaUnique<T> make_arena_unique(Arena& arena, Args&&... args) noexcept {
+            auto ptr = arena.allocate<T>(1);
+            if (ptr == nullptr) {
+                return ArenaUnique<T>();
+            }
+            construct(ptr, std::forward<Args>(args)...);
+            return ArenaUnique<T>(ptr);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,142 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file provides memory budgets for the pool behind `mem::allocate`: `mem::set_budget`, `mem::register_budget`
+ * and `mem::set_pressure_callback`.
+ * 
+ * A budget caps the bytes held by the blocks of one statistics tag, so a subsystem that allocates under a 
+ * `TagScope` fails its own allocations instead of growing until the kernel kills the process. When the budget 
+ * reaches its soft limit the pressure callback runs once, which is where caches drop entries; it runs again only 
+ * after the usage fell back below the soft limit. Budgets count what the pool holds for the caller: the size class
+ * of small blocks, the requested bytes of large blocks and the mapped bytes of mapped and huge blocks.
+ * 
+ * @file mem_budget.hpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#ifndef __GLX__CORE__MEM__BUDGET__HPP__
+#define __GLX__CORE__MEM__BUDGET__HPP__
+#include "mem_stats.hpp"
+#include "status_code.hpp"
+
+namespace glx {
+    namespace mem {
+        using __ignore::PressureCallback;
+
+        /// Pass as a limit to lift it.
+        constexpr usize kUnlimitedBytes = usize(INT64_MAX);
+
+        /**
+         * Cap the bytes held by the blocks of `tag`. Allocations that would pass `limitBytes` fail, and the pressure
+         * callback of the tag runs when the usage reaches `softBytes`.
+         * @author ZhangKeyangZzz
+         * @param[in] tag A tag returned by `register_tag`.
+         * @param[in] limitBytes The hard limit, `kUnlimitedBytes` for none.
+         * @param[in] softBytes The soft limit, no larger than `limitBytes`.
+         * @return Returns `Success`, or `IllegalArgument` if `tag` is 0 or unknown, or `softBytes > limitBytes`.
+         * @note The tag is charged from its first budget on. Blocks it allocated before are taken from `stats`, so
+         *       set the budget before the tag is used if it must be exact, and when built with `GLX_MEM_STATS=0`.
+         */
+        inline int set_budget(uint16 tag, usize limitBytes, usize softBytes) noexcept {
+            if (tag == 0 || tag >= kStatsTagCount || softBytes > limitBytes) {
+                return StatusCode::IllegalArgument;
+            }
+            {
+                auto& registry = __ignore::__tag_registry();
+                std::lock_guard<std::mutex> guard(registry._lock);
+                if (tag >= registry._count) {
+                    return StatusCode::IllegalArgument;
+                }
+            }
+            auto& table  = __ignore::__budget_table();
+            auto& budget = table.budgets[tag];
+            std::lock_guard<std::mutex> guard(table.lock);
+            auto bit = uint64(1) << tag;
+            if ((__ignore::__budgeted_tags().load() & bit) == 0) {
+#if GLX_MEM_STATS
+                auto counters = stats().tags[tag];
+                budget.used.store(int64(counters.allocatedBytes - counters.freedBytes), std::memory_order_relaxed);
+#endif
+                __ignore::__budgeted_tags().fetch_or(bit);
+            }
+            auto limit = limitBytes < kUnlimitedBytes ? int64(limitBytes) : INT64_MAX;
+            auto soft  = softBytes < kUnlimitedBytes ? int64(softBytes) : INT64_MAX;
+            budget.limit.store(limit, std::memory_order_relaxed);
+            budget.soft.store(soft, std::memory_order_relaxed);
+            if (budget.used.load(std::memory_order_relaxed) < soft) {
+                budget.pressed.store(false, std::memory_order_relaxed);
+            }
+            return StatusCode::Success;
+        }
+
+        /**
+         * Register a tag with a budget in one step, see `register_tag` and `set_budget`.
+         * @author ZhangKeyangZzz
+         * @param[in] name The name of the tag.
+         * @param[in] limitBytes The hard limit.
+         * @param[in] softBytes The soft limit, no larger than `limitBytes`.
+         * @return Returns the tag, or 0 if `name` is null, every tag is taken or `softBytes > limitBytes`.
+         */
+        inline uint16 register_budget(const char* name, usize limitBytes, usize softBytes) noexcept {
+            auto tag = register_tag(name);
+            if (tag == 0 || set_budget(tag, limitBytes, softBytes) != StatusCode::Success) {
+                return 0;
+            }
+            return tag;
+        }
+
+        /**
+         * Set the function called when the budget of `tag` reaches its soft limit, or an allocation fails at its
+         * hard limit. It runs on the allocating thread, which may free and allocate inside it.
+         * @author ZhangKeyangZzz
+         * @param[in] tag A tag with a budget.
+         * @param[in] callback The function, or nullptr for none.
+         * @param[in] context Passed to `callback` as it is.
+         * @return Returns `Success`, or `IllegalArgument` if `tag` is 0 or out of range.
+         */
+        inline int set_pressure_callback(uint16 tag, PressureCallback callback, void* context) noexcept {
+            if (tag == 0 || tag >= kStatsTagCount) {
+                return StatusCode::IllegalArgument;
+            }
+            auto& table = __ignore::__budget_table();
+            std::lock_guard<std::mutex> guard(table.lock);
+            table.budgets[tag].callback = callback;
+            table.budgets[tag].context  = context;
+            return StatusCode::Success;
+        }
+
+        /// Return the bytes charged to the budget of `tag`, 0 if it has none.
+        inline usize budget_used(uint16 tag) noexcept {
+            if (tag >= kStatsTagCount || !__ignore::__budgeted(tag)) {
+                return 0;
+            }
+            auto used = __ignore::__budget_table().budgets[tag].used.load(std::memory_order_relaxed);
+            return used > 0 ? usize(used) : 0;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,365 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file provides the fixed-size object pool `mem::ObjectPool` and the mixin `mem::PooledObject` that sends 
+ * `new` and `delete` of an `Object` subclass through it.
+ * 
+ * Every type gets its own pool. Slots carry no header, so a free is a push onto the free list of the calling
+ * thread without any size lookup. Free lists overflow into (and refill from) a depot shared by all threads in 
+ * batches, like the thread caches of `mem::allocate`. Slabs are never given back, the pool lives for the whole
+ * process.
+ * 
+ * @file mem_object_pool.hpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#ifndef __GLX__CORE__MEM__OBJECT__POOL__HPP__
+#define __GLX__CORE__MEM__OBJECT__POOL__HPP__
+#include "mem_utilities.hpp"
+#include "object.hpp"
+
+namespace glx {
+    namespace mem {
+        namespace __ignore {
+            /// The size and alignment of the slots of a pool of `T`. A free slot holds two links.
+            template <typename T>
+            struct PoolSlot {
+                static constexpr usize kAlign = alignof(T) > alignof(void*) ? alignof(T) : alignof(void*);
+                static constexpr usize kBytes = ((sizeof(T) > 2 * sizeof(void*) ? sizeof(T) : 2 * sizeof(void*)) + kAlign - 1) / kAlign * kAlign;
+                static constexpr usize kCount = kSlabBytes / kBytes;
+                /// The count of slots moved between a thread and the depot at once.
+                static constexpr uint32 kBatch = kCount / 8 < 4 ? 4 : kCount / 8 > 64 ? 64 : uint32(kCount / 8);
+            };
+
+            ///
+            /// `PoolDepot` holds the slots no thread is caching: a stack of full batches, linked through the second
+            /// word of their first slot, and a loose chain of the slots left over by exited threads.
+            /// @author ZhangKeyangZzz
+            ///
+            template <typename T>
+            class alignas(kCacheLineBytes) PoolDepot {
+                using _Slot = PoolSlot<T>;
+
+                std::mutex _lock;
+                void*      _batches = nullptr;
+                void*      _loose   = nullptr;
+
+            public:
+                /// Push a chain of exactly `kBatch` slots.
+                void push_batch(void* head) noexcept {
+                    std::lock_guard<std::mutex> guard(_lock);
+                    __next_batch_of(head) = _batches;
+                    _batches = head;
+                }
+
+                /// Push a chain of slots ending at `tail`, of any length.
+                void push_loose(void* head, void* tail) noexcept {
+                    std::lock_guard<std::mutex> guard(_lock);
+                    __next_of(tail) = _loose;
+                    _loose = head;
+                }
+
+                /// Pop a chain of at most `kBatch` slots, carving a fresh slab when the depot is empty.
+                bool pop(void*& head, uint32& length) noexcept {
+                    {
+                        std::lock_guard<std::mutex> guard(_lock);
+                        if (_batches != nullptr) {
+                            head = _batches;
+                            _batches = __next_batch_of(head);
+                            length = _Slot::kBatch;
+                            return true;
+                        }
+                        if (_loose != nullptr) {
+                            head = _loose;
+                            auto tail = head;
+                            length = 1;
+                            for (; length < _Slot::kBatch && __next_of(tail) != nullptr; length++) {
+                                tail = __next_of(tail);
+                            }
+                            _loose = __next_of(tail);
+                            __next_of(tail) = nullptr;
+                            return true;
+                        }
+                    }
+                    return _carve(head, length);
+                }
+
+            private:
+                /// Cut a new slab into slots, keep the first batch and publish the rest.
+                bool _carve(void*& head, uint32& length) noexcept {
+                    auto slabBytes = _Slot::kCount < _Slot::kBatch ? _Slot::kBytes * _Slot::kBatch : kSlabBytes;
+                    auto slab = _Slot::kAlign <= kBlockHeaderBytes
+                        ? allocate<byte>(slabBytes)
+                        : allocate_aligned<byte>(slabBytes, _Slot::kAlign);
+                    if (slab == nullptr) {
+                        return false;
+                    }
+                    auto total = uint32(slabBytes / _Slot::kBytes);
+                    head   = slab;
+                    length = _Slot::kBatch;
+                    for (uint32 first = 0; first < total; first += _Slot::kBatch) {
+                        auto count = total - first < _Slot::kBatch ? total - first : _Slot::kBatch;
+                        auto chain = slab + first * _Slot::kBytes;
+                        for (uint32 i = 0; i + 1 < count; i++) {
+                            __next_of(chain + i * _Slot::kBytes) = chain + (i + 1) * _Slot::kBytes;
+                        }
+                        auto tail = chain + (count - 1) * _Slot::kBytes;
+                        __next_of(tail) = nullptr;
+                        if (first == 0) {
+                            continue;
+                        }
+                        if (count == _Slot::kBatch) {
+                            push_batch(chain);
+                        } else {
+                            push_loose(chain, tail);
+                        }
+                    }
+                    return true;
+                }
+            };
+
+            /// The depot of a pool lives for the whole process, like the central cache of `mem::allocate`.
+            template <typename T>
+            inline PoolDepot<T>& __pool_depot() noexcept {
+                static typename std::aligned_storage<sizeof(PoolDepot<T>), alignof(PoolDepot<T>)>::type storage;
+                static PoolDepot<T>* depot = new (&storage) PoolDepot<T>();
+                return *depot;
+            }
+
+            /// The free list of the calling thread. Trivially destructible, so it stays usable while other
+            /// thread-local destructors run; `state` tells whether it's unbound, bound or drained at thread exit.
+            struct PoolFreeList {
+                void*  head   = nullptr;
+                uint32 length = 0;
+                uint8  state  = kCacheUnbound;
+            };
+
+            template <typename T>
+            inline PoolFreeList& __pool_free_list() noexcept {
+                thread_local PoolFreeList list;
+                return list;
+            }
+
+            /// Give every slot of the calling thread back to the depot.
+            template <typename T>
+            inline void __pool_drain(PoolFreeList& list) noexcept {
+                if (list.head == nullptr) {
+                    return;
+                }
+                auto tail = list.head;
+                while (__next_of(tail) != nullptr) {
+                    tail = __next_of(tail);
+                }
+                __pool_depot<T>().push_loose(list.head, tail);
+                list.head   = nullptr;
+                list.length = 0;
+            }
+
+            template <typename T>
+            struct PoolReaper {
+                ~PoolReaper() noexcept {
+                    auto& list = __pool_free_list<T>();
+                    __pool_drain<T>(list);
+                    list.state = kCacheExited;
+                }
+            };
+
+            /// Return the free list of the calling thread, or nullptr once the thread is shutting down.
+            template <typename T>
+            inline PoolFreeList* __pool_thread_list() noexcept {
+                auto& list = __pool_free_list<T>();
+                if (list.state == kCacheBound) {
+                    return &list;
+                }
+                if (list.state == kCacheExited) {
+                    return nullptr;
+                }
+                thread_local PoolReaper<T> reaper;
+                (void)reaper;
+                list.state = kCacheBound;
+                return &list;
+            }
+        }
+
+        /**
+         * `ObjectPool` recycles the memory of objects of exactly one type. Every thread allocates from and frees 
+         * to its own free list without locking; the lists trade batches of slots with a depot shared by all
+         * threads, and drain into it when their thread exits.
+         * @author ZhangKeyangZzz
+         * @tparam T The type of object.
+         * @note A slot may be freed on any thread. Slots are uninitialized memory, `create`/`destroy` also run
+         *       the constructor and destructor.
+         */
+        template <typename T>
+        class ObjectPool {
+            using _Slot = __ignore::PoolSlot<T>;
+
+        public:
+            ObjectPool() = delete;
+
+            /**
+             * Take an uninitialized slot.
+             * @author ZhangKeyangZzz
+             * @return Returns the slot, or nullptr if the system is out of memory.
+             */
+            static T* allocate() noexcept {
+                auto list = __ignore::__pool_thread_list<T>();
+                void* slot;
+                if (list == nullptr) {
+                    uint32 length;
+                    if (!__ignore::__pool_depot<T>().pop(slot, length)) {
+                        return nullptr;
+                    }
+                    if (length > 1) {
+                        auto rest = __ignore::__next_of(slot);
+                        auto tail = rest;
+                        while (__ignore::__next_of(tail) != nullptr) {
+                            tail = __ignore::__next_of(tail);
+                        }
+                        __ignore::__pool_depot<T>().push_loose(rest, tail);
+                    }
+                    return reinterpret_cast<T*>(slot);
+                }
+                if (list->head == nullptr) {
+                    uint32 length;
+                    if (!__ignore::__pool_depot<T>().pop(list->head, length)) {
+                        return nullptr;
+                    }
+                    list->length = length;
+                }
+                slot = list->head;
+                list->head = __ignore::__next_of(slot);
+                list->length--;
+                return reinterpret_cast<T*>(slot);
+            }
+
+            /**
+             * Give back a slot taken by `allocate`.
+             * @author ZhangKeyangZzz
+             * @param[in] object The slot; its object must already be destroyed. May be nullptr.
+             */
+            static void deallocate(T* object) noexcept {
+                if (object == nullptr) {
+                    return;
+                }
+                auto slot = reinterpret_cast<void*>(object);
+                auto list = __ignore::__pool_thread_list<T>();
+                if (list == nullptr) {
+                    __ignore::__next_of(slot) = nullptr;
+                    __ignore::__pool_depot<T>().push_loose(slot, slot);
+                    return;
+                }
+                __ignore::__next_of(slot) = list->head;
+                list->head = slot;
+                list->length++;
+                if (list->length > _Slot::kBatch * 2) {
+                    _release(*list);
+                }
+            }
+
+            /**
+             * Take a slot and construct an object in it.
+             * @author ZhangKeyangZzz
+             * @param[in] args The arguments of the constructor.
+             * @tparam Args The argument types.
+             * @return Returns the object, or nullptr if the system is out of memory.
+             */
+            template <typename... Args>
+            static T* create(Args&&... args) noexcept {
+                auto object = allocate();
+                if (object != nullptr) {
+                    construct(object, std::forward<Args>(args)...);
+                }
+                return object;
+            }
+
+            /// Destroy an object made by `create` and give back its slot.
+            static void destroy(T* object) noexcept {
+                if (object != nullptr) {
+                    destruct(object);
+                    deallocate(object);
+                }
+            }
+
+            /// Give every slot cached by the calling thread back to the depot.
+            static void flush() noexcept {
+                auto list = __ignore::__pool_thread_list<T>();
+                if (list != nullptr) {
+                    __ignore::__pool_drain<T>(*list);
+                }
+            }
+
+        private:
+            /// Detach the first `kBatch` slots of the free list and hand them to the depot.
+            static void _release(__ignore::PoolFreeList& list) noexcept {
+                auto first = list.head;
+                auto last  = first;
+                for (uint32 i = 1; i < _Slot::kBatch; i++) {
+                    last = __ignore::__next_of(last);
+                }
+                list.head = __ignore::__next_of(last);
+                list.length -= _Slot::kBatch;
+                __ignore::__next_of(last) = nullptr;
+                __ignore::__pool_depot<T>().push_batch(first);
+            }
+        };
+
+        /**
+         * `PooledObject` makes `new Derived` and `delete` take the memory of `Derived` from `ObjectPool<Derived>`.
+         * Use it as `class Message : public mem::PooledObject<Message>`, or `mem::PooledObject<Message, RefCounted>`
+         * to keep another `Object` base. A subclass of `Derived` of a different size falls back to `mem::allocate`.
+         * @author ZhangKeyangZzz
+         * @tparam Derived The class deriving from this one.
+         * @tparam Base `Object` or one of its subclasses.
+         * @note Arrays, arena placement and over-aligned `new` still go through `Base`.
+         */
+        template <typename Derived, typename Base = Object>
+        class PooledObject : public Base {
+        public:
+            using Base::operator new;
+            using Base::operator delete;
+
+            static void* operator new(size_t totalBytes) noexcept {
+                return totalBytes == sizeof(Derived)
+                    ? static_cast<void*>(ObjectPool<Derived>::allocate())
+                    : static_cast<void*>(mem::allocate<byte>(totalBytes));
+            }
+            static void operator delete(void* ptr, size_t totalBytes) noexcept {
+                if (totalBytes == sizeof(Derived)) {
+                    ObjectPool<Derived>::deallocate(reinterpret_cast<Derived*>(ptr));
+                } else {
+                    mem::deallocate(ptr, totalBytes);
+                }
+            }
+
+        protected:
+            using Base::Base;
+            PooledObject() noexcept = default;
+        };
+    }
+}
+
+#endif
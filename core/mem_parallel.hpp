@@ -0,0 +1,424 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file provides parallel versions of the bulk `mem` range functions in sub-namespace `mem::par`.
+ * They run on `ThreadPool::global()` and produce exactly the result of their serial counterparts.
+ * 
+ * @file mem_parallel.hpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#ifndef __GLX__CORE__MEM__PARALLEL__HPP__
+#define __GLX__CORE__MEM__PARALLEL__HPP__
+#include "mem_utilities.hpp"
+#include "thread_pool.hpp"
+
+namespace glx {
+    namespace mem {
+        namespace par {
+            /// Ranges smaller than this many bytes aren't worth waking the pool for.
+            constexpr usize kParallelMinBytes = 1024 * 1024;
+
+            /// The target bytes of one chunk.
+            constexpr usize kParallelGrainBytes = 256 * 1024;
+
+            /// Which thread initializes which part of an uninitialized range.
+            enum TouchPolicy {
+                BalancedTouch = 0,  /// Chunks go to whichever thread is free, the fastest way to fill the range.
+                FirstTouch    = 1,  /// Thread `i` of `ThreadPool::for_each_thread` initializes slice `i`, see below.
+            };
+
+            namespace __ignore {
+                constexpr usize __gcd(usize a, usize b) noexcept {
+                    return b == 0 ? a : __gcd(b, a % b);
+                }
+
+                ///
+                /// `ChunkPlan` splits `length` elements written at `base` into chunks whose boundaries fall on
+                /// cache line boundaries of the destination, so no two threads ever write the same line.
+                /// Chunk 0 absorbs the elements before the first line boundary.
+                /// @author ZhangKeyangZzz
+                ///
+                template <typename T>
+                struct ChunkPlan {
+                    usize head;
+                    usize step;
+                    usize length;
+
+                    ChunkPlan(T const* base, usize length) noexcept : length(length) {
+                        auto lineElements = kCacheLineBytes / __gcd(sizeof(T), kCacheLineBytes);
+                        auto grain        = kParallelGrainBytes / sizeof(T);
+                        step = grain > lineElements ? grain - grain % lineElements : lineElements;
+                        auto misalign = (kCacheLineBytes - reinterpret_cast<uintptr_t>(base) % kCacheLineBytes) % kCacheLineBytes;
+                        head = misalign % sizeof(T) == 0 ? misalign / sizeof(T) : 0;
+                        if (head > length) {
+                            head = length;
+                        }
+                    }
+
+                    usize count() const noexcept {
+                        return 1 + (length - head + step - 1) / step;
+                    }
+
+                    usize begin(usize chunk) const noexcept {
+                        return chunk == 0 ? 0 : head + (chunk - 1) * step;
+                    }
+
+                    usize end(usize chunk) const noexcept {
+                        auto end = head + chunk * step;
+                        return end < length ? end : length;
+                    }
+                };
+
+                template <typename T>
+                bool __worth_parallel(usize length) noexcept {
+                    return length > kParallelMinBytes / sizeof(T) && ThreadPool::global().concurrency() > 1;
+                }
+
+                /// Run `body(begin, end)` over `[0, length)` in chunks aligned to the cache lines of `base`.
+                template <typename T, typename F>
+                void __for_each_chunk(T const* base, usize length, F&& body) noexcept {
+                    ChunkPlan<T> plan(base, length);
+                    ThreadPool::global().parallel_for(plan.count(), [&](usize chunk) {
+                        auto begin = plan.begin(chunk);
+                        auto end   = plan.end(chunk);
+                        if (begin < end) {
+                            body(begin, end);
+                        }
+                    });
+                }
+
+                /**
+                 * Copy `arr[srcIndex .. srcIndex + length)` onto an overlapping `arr[dstIndex ..)` in waves.
+                 * A wave of `distance` elements starting at the leading edge only reads elements that no earlier 
+                 * wave has written and only writes elements that every earlier wave has already read, so the 
+                 * elements inside one wave can be copied in parallel.
+                 */
+                template <typename T, typename F>
+                void __for_each_overlapping_wave(T* arr, usize dstIndex, usize srcIndex, usize length, F&& copy) noexcept {
+                    auto distance = dstIndex > srcIndex ? dstIndex - srcIndex : srcIndex - dstIndex;
+                    for (usize done = 0; done < length; done += distance) {
+                        auto count = length - done < distance ? length - done : distance;
+                        auto first = dstIndex > srcIndex ? length - done - count : done;
+                        __for_each_chunk(arr + dstIndex + first, count, [&](usize begin, usize end) {
+                            copy(dstIndex + first + begin, srcIndex + first + begin, end - begin);
+                        });
+                    }
+                }
+
+                ///
+                /// `SlicePlan` splits `length` elements at `base` into `slices` contiguous slices made of whole pages of
+                /// `base`, so every page is first touched by one thread. Pages are dealt out evenly in order: when
+                /// there are fewer pages than slices, the leading slices get one page each and the rest are empty.
+                /// A slice starts at the first element starting on or after its page boundary.
+                /// @author ZhangKeyangZzz
+                ///
+                template <typename T>
+                struct SlicePlan {
+                    uintptr_t start;
+                    usize     length;
+                    usize     slices;
+                    usize     page;
+                    usize     pages;
+
+                    SlicePlan(T const* base, usize length, usize slices, usize page) noexcept
+                        : start(reinterpret_cast<uintptr_t>(base)), length(length), slices(slices), page(page) {
+                        pages = length == 0 ? 0 : usize((start + (length - 1) * sizeof(T)) / page - start / page + 1);
+                    }
+
+                    usize begin(usize slice) const noexcept {
+                        if (slice == 0) {
+                            return 0;
+                        }
+                        auto first = slice < slices ? pages / slices * slice + (slice < pages % slices ? slice : pages % slices) : pages;
+                        if (first >= pages) {
+                            return length;
+                        }
+                        auto address = (start & ~uintptr_t(page - 1)) + first * page;
+                        auto index   = usize((address - start + sizeof(T) - 1) / sizeof(T));
+                        return index < length ? index : length;
+                    }
+
+                    usize end(usize slice) const noexcept {
+                        return begin(slice + 1);
+                    }
+                };
+
+                /**
+                 * Run `body(begin, end)` once on every thread of the pool, over the `concurrency()` slices of a 
+                 * `SlicePlan`, so every page is first touched by one thread, and placed on its node.
+                 */
+                template <typename T, typename F>
+                void __for_each_thread_slice(T const* base, usize length, F&& body) noexcept {
+                    auto& pool = ThreadPool::global();
+                    SlicePlan<T> plan(base, length, pool.concurrency(), mem::__ignore::__page_bytes());
+                    pool.for_each_thread([&](usize slice) {
+                        auto begin = plan.begin(slice);
+                        auto end   = plan.end(slice);
+                        if (begin < end) {
+                            body(begin, end);
+                        }
+                    });
+                }
+
+                /// First touch only pays off where there are several nodes to place pages on.
+                template <typename T>
+                bool __worth_first_touch(usize length, TouchPolicy touch) noexcept {
+                    return touch == FirstTouch && numa_node_count() > 1 && __worth_parallel<T>(length);
+                }
+
+                template <typename T>
+                CopyPolicy __policy_for(usize length) noexcept {
+                    return length * sizeof(T) >= streaming_threshold() ? StreamingCopy : CachedCopy;
+                }
+            }
+
+            /**
+             * Parallel `mem::copy_of_range`. Copy specified count of objects from `src[srcIndex]` to `dst[dstIndex]`.
+             * @author ZhangKeyangZzz
+             * @param[in] dst The destination array.
+             * @param[in] src The source array.
+             * @param[in] srcIndex The offset of source position.
+             * @param[in] dstIndex The offset of destination position.
+             * @param[in] length The length of copy section.
+             * @tparam T The type of elements in both array.
+             * @return Return the status code representing whether the operation was successful.
+             */
+            template <typename T>
+            int copy_of_range(T *const dst, const T* src, usize dstIndex, usize srcIndex, usize length) noexcept {
+                if (dst == nullptr || src == nullptr || length == 0) {
+                    return StatusCode::IllegalArgument;
+                }
+                auto dstPtr = dst + dstIndex;
+                auto srcPtr = src + srcIndex;
+                auto overlap = dstPtr < srcPtr + length && srcPtr < dstPtr + length;
+                if (overlap || !__ignore::__worth_parallel<T>(length)) {
+                    return mem::copy_of_range(dst, src, dstIndex, srcIndex, length);
+                }
+                auto policy = __ignore::__policy_for<T>(length);
+                __ignore::__for_each_chunk(dstPtr, length, [&](usize begin, usize end) {
+                    mem::copy_of_range(dstPtr, srcPtr, begin, begin, end - begin, policy);
+                });
+                return StatusCode::Success;
+            }
+
+            /**
+             * Parallel `mem::copy_of_range`. Copy specified count of objects from `arr[srcIndex]` to `arr[dstIndex]`.
+             * Overlapping sections are copied in waves and stay correct.
+             * @author ZhangKeyangZzz
+             * @param[in] arr A pointer to the array.
+             * @param[in] srcIndex The offset of source position.
+             * @param[in] dstIndex The offset of destination position.
+             * @param[in] length The length of copy section.
+             * @tparam T The type of elements in the array.
+             * @return Return the status code representing whether the operation was successful.
+             */
+            template <typename T>
+            int copy_of_range(T *const arr, usize dstIndex, usize srcIndex, usize length) noexcept {
+                if (arr == nullptr || length == 0) {
+                    return StatusCode::IllegalArgument;
+                }
+                auto distance = dstIndex > srcIndex ? dstIndex - srcIndex : srcIndex - dstIndex;
+                if (distance >= length) {
+                    return par::copy_of_range(arr, arr, dstIndex, srcIndex, length);
+                }
+                if (distance == 0 || !__ignore::__worth_parallel<T>(distance)) {
+                    return mem::copy_of_range(arr, dstIndex, srcIndex, length);
+                }
+                __ignore::__for_each_overlapping_wave(arr, dstIndex, srcIndex, length, [&](usize dstAt, usize srcAt, usize count) {
+                    mem::copy_of_range(arr, arr, dstAt, srcAt, count);
+                });
+                return StatusCode::Success;
+            }
+
+            /**
+             * Parallel `mem::uninitialized_copy_of_range`. Copy-construct specified count of objects from 
+             * `src[srcIndex]` into the uninitialized `dst[dstIndex]`.
+             * @author ZhangKeyangZzz
+             * @param[in] dst The destination array.
+             * @param[in] src The source array.
+             * @param[in] srcIndex The offset of source position.
+             * @param[in] dstIndex The offset of destination position.
+             * @param[in] length The length of copy section.
+             * @tparam T The type of elements in both array.
+             * @return Return the status code representing whether the operation was successful.
+             */
+            template <typename T>
+            int uninitialized_copy_of_range(T *const dst, const T* src, usize dstIndex, usize srcIndex, usize length) noexcept {
+                if (dst == nullptr || src == nullptr || length == 0) {
+                    return StatusCode::IllegalArgument;
+                }
+                auto dstPtr = dst + dstIndex;
+                auto srcPtr = src + srcIndex;
+                auto overlap = dstPtr < srcPtr + length && srcPtr < dstPtr + length;
+                if (overlap || !__ignore::__worth_parallel<T>(length)) {
+                    return mem::uninitialized_copy_of_range(dst, src, dstIndex, srcIndex, length);
+                }
+                auto policy = __ignore::__policy_for<T>(length);
+                __ignore::__for_each_chunk(dstPtr, length, [&](usize begin, usize end) {
+                    mem::uninitialized_copy_of_range(dstPtr, srcPtr, begin, begin, end - begin, policy);
+                });
+                return StatusCode::Success;
+            }
+
+            /**
+             * Parallel `mem::uninitialized_copy_of_range` choosing which thread constructs which elements. With 
+             * `FirstTouch`, thread `i` of the pool constructs the `i`-th of `concurrency()` page-aligned slices, so 
+             * on a NUMA machine each slice is placed on the node of the thread that will work on it if later loops
+             * split the range the same way through `ThreadPool::for_each_thread`.
+             * @author ZhangKeyangZzz
+             * @param[in] dst The destination array, fresh from the system so that its pages are untouched.
+             * @param[in] src The source array.
+             * @param[in] srcIndex The offset of source position.
+             * @param[in] dstIndex The offset of destination position.
+             * @param[in] length The length of copy section.
+             * @param[in] touch The touch policy.
+             * @tparam T The type of elements in both array.
+             * @return Return the status code representing whether the operation was successful.
+             * @note On a single-node machine `FirstTouch` behaves as `BalancedTouch`.
+             */
+            template <typename T>
+            int uninitialized_copy_of_range(T *const dst, const T* src, usize dstIndex, usize srcIndex, usize length, TouchPolicy touch) noexcept {
+                if (dst == nullptr || src == nullptr || length == 0) {
+                    return StatusCode::IllegalArgument;
+                }
+                auto dstPtr = dst + dstIndex;
+                auto srcPtr = src + srcIndex;
+                auto overlap = dstPtr < srcPtr + length && srcPtr < dstPtr + length;
+                if (overlap || !__ignore::__worth_first_touch<T>(length, touch)) {
+                    return par::uninitialized_copy_of_range(dst, src, dstIndex, srcIndex, length);
+                }
+                auto policy = __ignore::__policy_for<T>(length);
+                __ignore::__for_each_thread_slice(dstPtr, length, [&](usize begin, usize end) {
+                    mem::uninitialized_copy_of_range(dstPtr, srcPtr, begin, begin, end - begin, policy);
+                });
+                return StatusCode::Success;
+            }
+
+            /**
+             * Parallel `mem::fill_of_range`. Fill the initialized buffer `arr[index .. index + length)` with the specified value.
+             * @author ZhangKeyangZzz
+             * @param[in] arr The specified buffer.
+             * @param[in] index The specified index.
+             * @param[in] length The length of the buffer.
+             * @param[in] value The target value.
+             * @tparam T The type of elements in the array.
+             * @return Return the status code representing whether the operation was successful.
+             */
+            template <typename T>
+            int fill_of_range(T *const arr, usize index, usize length, T const& value) noexcept {
+                if (arr == nullptr) {
+                    return StatusCode::IllegalArgument;
+                }
+                if (!__ignore::__worth_parallel<T>(length)) {
+                    return mem::fill_of_range(arr, index, length, value);
+                }
+                auto ptr = arr + index;
+                __ignore::__for_each_chunk(ptr, length, [&](usize begin, usize end) {
+                    mem::fill_of_range(ptr, begin, end - begin, value);
+                });
+                return StatusCode::Success;
+            }
+
+            /**
+             * Parallel `mem::uninitialized_fill_of_range`. Fill the uninitialized buffer `arr[index .. index + length)` 
+             * with the specified value.
+             * @author ZhangKeyangZzz
+             * @param[in] arr The specified buffer.
+             * @param[in] index The specified index.
+             * @param[in] length The length of the buffer.
+             * @param[in] value The target value.
+             * @tparam T The type of elements in the array.
+             * @return Return the status code representing whether the operation was successful.
+             */
+            template <typename T>
+            int uninitialized_fill_of_range(T *const arr, usize index, usize length, T const& value) noexcept {
+                if (arr == nullptr) {
+                    return StatusCode::IllegalArgument;
+                }
+                if (!__ignore::__worth_parallel<T>(length)) {
+                    return mem::uninitialized_fill_of_range(arr, index, length, value);
+                }
+                auto ptr = arr + index;
+                __ignore::__for_each_chunk(ptr, length, [&](usize begin, usize end) {
+                    mem::uninitialized_fill_of_range(ptr, begin, end - begin, value);
+                });
+                return StatusCode::Success;
+            }
+
+            /**
+             * Parallel `mem::uninitialized_fill_of_range` choosing which thread constructs which elements, see 
+             * the `TouchPolicy` overload of `uninitialized_copy_of_range`.
+             * @author ZhangKeyangZzz
+             * @param[in] arr The specified buffer, fresh from the system so that its pages are untouched.
+             * @param[in] index The specified index.
+             * @param[in] length The length of the buffer.
+             * @param[in] value The target value.
+             * @param[in] touch The touch policy.
+             * @tparam T The type of elements in the array.
+             * @return Return the status code representing whether the operation was successful.
+             * @note On a single-node machine `FirstTouch` behaves as `BalancedTouch`.
+             */
+            template <typename T>
+            int uninitialized_fill_of_range(T *const arr, usize index, usize length, T const& value, TouchPolicy touch) noexcept {
+                if (arr == nullptr) {
+                    return StatusCode::IllegalArgument;
+                }
+                if (!__ignore::__worth_first_touch<T>(length, touch)) {
+                    return par::uninitialized_fill_of_range(arr, index, length, value);
+                }
+                auto ptr = arr + index;
+                __ignore::__for_each_thread_slice(ptr, length, [&](usize begin, usize end) {
+                    mem::uninitialized_fill_of_range(ptr, begin, end - begin, value);
+                });
+                return StatusCode::Success;
+            }
+
+            /**
+             * Parallel `mem::destruct_of_range`. Destruct the initialized buffer `arr[index .. index + length)`.
+             * Trivially destructible types have nothing to do and never touch the pool.
+             * @author ZhangKeyangZzz
+             * @param[in] arr The specified buffer.
+             * @param[in] index The specified index.
+             * @param[in] length The length of the buffer.
+             * @tparam T The type of elements in the array.
+             */
+            template <typename T>
+            void destruct_of_range(T *const arr, usize index, usize length) noexcept {
+                if (std::is_trivially_destructible<T>::value || !__ignore::__worth_parallel<T>(length)) {
+                    mem::destruct_of_range(arr, index, length);
+                    return;
+                }
+                auto ptr = arr + index;
+                __ignore::__for_each_chunk(ptr, length, [&](usize begin, usize end) {
+                    mem::destruct_of_range(ptr, begin, end - begin);
+                });
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,172 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file provides the sampling heap profiler of the pool behind `mem::allocate`: `mem::start_heap_profiling`, 
+ * `mem::stop_heap_profiling` and `mem::write_heap_profile`.
+ * 
+ * About one block per sampling interval of allocated bytes is recorded together with the stack that allocated it,
+ * and is tracked until freed. Profiles are written in the text heap format of pprof, so 
+ * `pprof -inuse_space <binary> <file>` shows the live heap and `pprof -alloc_space <binary> <file>` the bytes 
+ * allocated since profiling started; pprof scales the samples back up by the interval.
+ * 
+ * @file mem_profile.hpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#ifndef __GLX__CORE__MEM__PROFILE__HPP__
+#define __GLX__CORE__MEM__PROFILE__HPP__
+#include "mem_allocator.hpp"
+#include "status_code.hpp"
+#include <cstdio>
+
+namespace glx {
+    namespace mem {
+        /// The mean distance in bytes between two samples unless `start_heap_profiling` is given another.
+        constexpr usize kDefaultSampleBytes = 512 * 1024;
+
+        /**
+         * Start sampling allocations. Every thread notices within 1 MB of its own allocations.
+         * @author ZhangKeyangZzz
+         * @param[in] sampleBytes The mean distance in bytes between two samples; smaller is more precise and slower.
+         * @note Does nothing when built with `GLX_MEM_PROFILE=0`. Blocks of `allocate_huge` and `ObjectPool` are
+         *       not sampled.
+         */
+        inline void start_heap_profiling(usize sampleBytes = kDefaultSampleBytes) noexcept {
+            auto& sampler = __ignore::__heap_sampler();
+            sampler.interval.store(sampleBytes == 0 ? 1 : sampleBytes, std::memory_order_relaxed);
+            sampler.enabled.store(true, std::memory_order_relaxed);
+        }
+
+        /**
+         * Stop taking new samples. Blocks sampled so far are still tracked until freed, so later profiles stay
+         * consistent.
+         * @author ZhangKeyangZzz
+         */
+        inline void stop_heap_profiling() noexcept {
+            __ignore::__heap_sampler().enabled.store(false, std::memory_order_relaxed);
+        }
+
+        /// Return whether allocations are being sampled.
+        inline bool heap_profiling() noexcept {
+            return __ignore::__heap_sampler().enabled.load(std::memory_order_relaxed);
+        }
+
+        namespace __ignore {
+            /// Copy every stack, so the file is written without holding up allocating threads.
+            inline SampleStack* __snapshot_stacks(usize& count) noexcept {
+                SampleStack* stacks = nullptr;
+                count = 0;
+                __heap_sampler().for_each_stack([&](SampleStack const&) {
+                    count++;
+                });
+                if (count == 0) {
+                    return nullptr;
+                }
+                stacks = reinterpret_cast<SampleStack*>(std::malloc(count * sizeof(SampleStack)));
+                if (stacks == nullptr) {
+                    return nullptr;
+                }
+                usize copied = 0;
+                __heap_sampler().for_each_stack([&](SampleStack const& stack) {
+                    if (copied < count) {
+                        stacks[copied++] = stack;
+                    }
+                });
+                count = copied;
+                return stacks;
+            }
+
+            /// pprof symbolizes the addresses with the mappings of the process.
+            inline bool __write_mappings(std::FILE* file) noexcept {
+                if (std::fputs("\nMAPPED_LIBRARIES:\n", file) < 0) {
+                    return false;
+                }
+                auto maps = std::fopen("/proc/self/maps", "r");
+                if (maps == nullptr) {
+                    return true;
+                }
+                char  buffer[4096];
+                usize length;
+                auto  ok = true;
+                while (ok && (length = std::fread(buffer, 1, sizeof(buffer), maps)) > 0) {
+                    ok = std::fwrite(buffer, 1, length, file) == length;
+                }
+                std::fclose(maps);
+                return ok;
+            }
+        }
+
+        /**
+         * Write the sampled heap to `path` in the text heap format of pprof. Every stack carries its live blocks
+         * and bytes, and the blocks and bytes it allocated since profiling first started.
+         * @author ZhangKeyangZzz
+         * @param[in] path The file to create or overwrite.
+         * @return Returns `Success`, `IllegalArgument` if `path` is null, or `IOError` if the file can't be written.
+         * @note Profiling doesn't have to be running; a profile written after `stop_heap_profiling` shows what was 
+         *       sampled before.
+         */
+        inline int write_heap_profile(const char* path) noexcept {
+            if (path == nullptr) {
+                return StatusCode::IllegalArgument;
+            }
+            usize count  = 0;
+            auto  stacks = __ignore::__snapshot_stacks(count);
+            auto  file   = std::fopen(path, "w");
+            if (file == nullptr) {
+                std::free(stacks);
+                return StatusCode::IOError;
+            }
+            __ignore::SampleStack total = {};
+            for (usize i = 0; i < count; i++) {
+                total.liveCount      += stacks[i].liveCount;
+                total.liveBytes      += stacks[i].liveBytes;
+                total.allocations    += stacks[i].allocations;
+                total.allocatedBytes += stacks[i].allocatedBytes;
+            }
+            auto interval = __ignore::__heap_sampler().interval.load(std::memory_order_relaxed);
+            auto ok = std::fprintf(file, "heap profile: %llu: %llu [%llu: %llu] @ heap_v2/%llu\n",
+                (unsigned long long)total.liveCount, (unsigned long long)total.liveBytes,
+                (unsigned long long)total.allocations, (unsigned long long)total.allocatedBytes,
+                (unsigned long long)interval) > 0;
+            for (usize i = 0; ok && i < count; i++) {
+                auto& stack = stacks[i];
+                ok = std::fprintf(file, "%llu: %llu [%llu: %llu] @",
+                    (unsigned long long)stack.liveCount, (unsigned long long)stack.liveBytes,
+                    (unsigned long long)stack.allocations, (unsigned long long)stack.allocatedBytes) > 0;
+                for (uint32 frame = 0; ok && frame < stack.depth; frame++) {
+                    ok = std::fprintf(file, " %p", stack.frames[frame]) > 0;
+                }
+                ok = ok && std::fputc('\n', file) != EOF;
+            }
+            ok = ok && __ignore::__write_mappings(file);
+            ok = std::fclose(file) == 0 && ok;
+            std::free(stacks);
+            return ok ? StatusCode::Success : StatusCode::IOError;
+        }
+    }
+}
+
+#endif
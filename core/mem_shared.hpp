@@ -0,0 +1,320 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file provides the reference-counted smart pointer `mem::Shared` and the intrusive counted base 
+ * `mem::RefCounted` for `Object` subclasses.
+ * 
+ * @file mem_shared.hpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#ifndef __GLX__CORE__MEM__SHARED__HPP__
+#define __GLX__CORE__MEM__SHARED__HPP__
+#include "mem_utilities.hpp"
+#include "object.hpp"
+#include <atomic>
+
+namespace glx {
+    namespace mem {
+        /// A reference count shared between threads.
+        struct AtomicRefCount {
+            std::atomic<uint32> value{ 0 };
+
+            void acquire() noexcept {
+                value.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            /// Return true when the last reference is gone.
+            bool release() noexcept {
+                return value.fetch_sub(1, std::memory_order_acq_rel) == 1;
+            }
+
+            uint32 load() const noexcept {
+                return value.load(std::memory_order_relaxed);
+            }
+        };
+
+        /// A reference count for data confined to one thread; a plain integer.
+        struct LocalRefCount {
+            uint32 value = 0;
+
+            void acquire() noexcept {
+                value++;
+            }
+
+            bool release() noexcept {
+                return --value == 0;
+            }
+
+            uint32 load() const noexcept {
+                return value;
+            }
+        };
+
+        /**
+         * `RefCountedBase` puts the reference count inside the object, so `Shared` needs no control block and
+         * converts freely from derived to base. Objects are created by `make_shared` or `new` and deleted by 
+         * `delete` through `Object`'s virtual destructor once the last `Shared` goes away.
+         * @author ZhangKeyangZzz
+         * @tparam Counter `AtomicRefCount` or `LocalRefCount`.
+         * @note Copying an object does not copy its count.
+         */
+        template <typename Counter>
+        class RefCountedBase : public Object {
+            mutable Counter _refs;
+
+        protected:
+            RefCountedBase() noexcept = default;
+            RefCountedBase(RefCountedBase const&) noexcept {}
+            RefCountedBase& operator=(RefCountedBase const&) noexcept { return *this; }
+            ~RefCountedBase() noexcept override = default;
+
+        public:
+            /// Return the number of `Shared` pointing to this object.
+            uint32 use_count() const noexcept { return _refs.load(); }
+            void acquire_ref() const noexcept { _refs.acquire(); }
+            bool release_ref() const noexcept { return _refs.release(); }
+        };
+
+        /// The base of objects shared between threads.
+        using RefCounted = RefCountedBase<AtomicRefCount>;
+
+        /// The base of objects shared within one thread.
+        using LocalRefCounted = RefCountedBase<LocalRefCount>;
+
+        namespace __ignore {
+            /// A value and its count in one block, for types that don't derive from `RefCountedBase`.
+            template <typename T, typename Counter>
+            struct SharedBox {
+                Counter refs;
+                T       value;
+
+                template <typename... Args>
+                explicit SharedBox(Args&&... args) noexcept : value(std::forward<Args>(args)...) {}
+            };
+
+            /// `Shared` of a `RefCountedBase` subclass points at the object itself.
+            template <typename T, typename Counter>
+            struct IntrusiveHolder {
+                using Holder = T;
+
+                static T* value_of(Holder* holder) noexcept { return holder; }
+                static void acquire(Holder* holder) noexcept { holder->acquire_ref(); }
+                static void release(Holder* holder) noexcept {
+                    if (holder->release_ref()) {
+                        delete holder;
+                    }
+                }
+                static uint32 count(Holder const* holder) noexcept { return holder->use_count(); }
+
+                template <typename... Args>
+                static Holder* create(Args&&... args) noexcept {
+                    return new T(std::forward<Args>(args)...);
+                }
+            };
+
+            /// `Shared` of any other type points at a `SharedBox`.
+            template <typename T, typename Counter>
+            struct BoxedHolder {
+                using Holder = SharedBox<T, Counter>;
+
+                static T* value_of(Holder* holder) noexcept { return &holder->value; }
+                static void acquire(Holder* holder) noexcept { holder->refs.acquire(); }
+                static void release(Holder* holder) noexcept {
+                    if (holder->refs.release()) {
+                        PoolDeleter<Holder>()(holder);
+                    }
+                }
+                static uint32 count(Holder const* holder) noexcept { return holder->refs.load(); }
+
+                template <typename... Args>
+                static Holder* create(Args&&... args) noexcept {
+                    auto holder = allocate<Holder>(1);
+                    if (holder != nullptr) {
+                        construct(holder, std::forward<Args>(args)...);
+                    }
+                    return holder;
+                }
+            };
+
+            template <typename T, typename Counter>
+            using SharedHolder = typename std::conditional<
+                std::is_base_of<RefCountedBase<Counter>, T>::value,
+                IntrusiveHolder<T, Counter>,
+                BoxedHolder<T, Counter>
+            >::type;
+        }
+
+        /**
+         * `Shared` is a reference-counted smart pointer the size of one pointer. A `RefCountedBase` subclass
+         * carries its own count; any other type lives in one block together with its count. Copies touch the
+         * count, moves never do.
+         * @author ZhangKeyangZzz
+         * @tparam T The type of object.
+         * @tparam Counter `AtomicRefCount` by default, `LocalRefCount` for data confined to one thread.
+         */
+        template <typename T, typename Counter = AtomicRefCount>
+        class Shared {
+            using _Traits = __ignore::SharedHolder<T, Counter>;
+            using _Holder = typename _Traits::Holder;
+
+            template <typename U, typename C>
+            friend class Shared;
+
+            template <typename U, typename C, typename... Args>
+            friend Shared<U, C> make_shared_with(Args&&... args) noexcept;
+
+            _Holder* _holder = nullptr;
+
+        private:
+            struct AdoptTag {};
+            Shared(_Holder* holder, AdoptTag) noexcept : _holder(holder) {}
+
+        public:
+            Shared() noexcept = default;
+            Shared(std::nullptr_t) noexcept {}
+
+            /// Share an object created by `new`; only for `RefCountedBase` subclasses.
+            template <typename U, typename = std::enable_if_t<std::is_same<_Holder, T>::value && std::is_convertible<U*, T*>::value>>
+            explicit Shared(U* object) noexcept : _holder(object) {
+                if (_holder != nullptr) {
+                    _Traits::acquire(_holder);
+                }
+            }
+
+            Shared(Shared const& rhs) noexcept : _holder(rhs._holder) {
+                if (_holder != nullptr) {
+                    _Traits::acquire(_holder);
+                }
+            }
+
+            Shared(Shared&& rhs) noexcept : _holder(rhs._holder) {
+                rhs._holder = nullptr;
+            }
+
+            /// Convert from a `Shared` of a derived type; only for `RefCountedBase` subclasses.
+            template <typename U, typename = std::enable_if_t<std::is_same<_Holder, T>::value && std::is_convertible<U*, T*>::value>>
+            Shared(Shared<U, Counter> const& rhs) noexcept : _holder(rhs._holder) {
+                if (_holder != nullptr) {
+                    _Traits::acquire(_holder);
+                }
+            }
+
+            template <typename U, typename = std::enable_if_t<std::is_same<_Holder, T>::value && std::is_convertible<U*, T*>::value>>
+            Shared(Shared<U, Counter>&& rhs) noexcept : _holder(rhs._holder) {
+                rhs._holder = nullptr;
+            }
+
+            ~Shared() noexcept {
+                if (_holder != nullptr) {
+                    _Traits::release(_holder);
+                }
+            }
+
+        public:
+            Shared& operator=(Shared const& rhs) noexcept {
+                if (_holder == rhs._holder) {
+                    return *this;
+                }
+                Shared(rhs).swap(*this);
+                return *this;
+            }
+
+            Shared& operator=(Shared&& rhs) noexcept {
+                Shared(std::move(rhs)).swap(*this);
+                return *this;
+            }
+
+            Shared& operator=(std::nullptr_t) noexcept {
+                reset();
+                return *this;
+            }
+
+        public:
+            T* get() const noexcept { return _holder != nullptr ? _Traits::value_of(_holder) : nullptr; }
+            T& operator*() const noexcept { return *get(); }
+            T* operator->() const noexcept { return get(); }
+            explicit operator bool() const noexcept { return _holder != nullptr; }
+
+            /// Return the number of `Shared` owning the object, 0 if empty.
+            uint32 use_count() const noexcept { return _holder != nullptr ? _Traits::count(_holder) : 0; }
+
+            void reset() noexcept { Shared().swap(*this); }
+
+            void swap(Shared& rhs) noexcept {
+                auto holder = _holder;
+                _holder = rhs._holder;
+                rhs._holder = holder;
+            }
+
+            friend bool operator==(Shared const& lhs, Shared const& rhs) noexcept { return lhs._holder == rhs._holder; }
+            friend bool operator!=(Shared const& lhs, Shared const& rhs) noexcept { return lhs._holder != rhs._holder; }
+        };
+
+        /// A `Shared` whose count is never touched by more than one thread.
+        template <typename T>
+        using LocalShared = Shared<T, LocalRefCount>;
+
+        /// `Shared` is one pointer that nothing else refers to, so it relocates by copying bytes.
+        template <typename T, typename Counter>
+        struct is_trivially_relocatable<Shared<T, Counter>> : std::true_type {};
+
+        /**
+         * Create an object and its count with a single allocation.
+         * @author ZhangKeyangZzz
+         * @param[in] args arguments to construct a object of type `T`
+         * @tparam T The type of object.
+         * @tparam Counter The reference count type.
+         * @tparam Args The argument types.
+         * @return Returns the object, or an empty `Shared` if the memory is exhausted.
+         */
+        template <typename T, typename Counter, typename... Args>
+        inline Shared<T, Counter> make_shared_with(Args&&... args) noexcept {
+            using Traits = __ignore::SharedHolder<T, Counter>;
+            auto holder = Traits::create(std::forward<Args>(args)...);
+            if (holder != nullptr) {
+                Traits::acquire(holder);
+            }
+            return Shared<T, Counter>(holder, typename Shared<T, Counter>::AdoptTag());
+        }
+
+        /// Create a `Shared` with an atomic count, see `make_shared_with`.
+        template <typename T, typename... Args>
+        inline Shared<T> make_shared(Args&&... args) noexcept {
+            return make_shared_with<T, AtomicRefCount>(std::forward<Args>(args)...);
+        }
+
+        /// Create a `LocalShared`, see `make_shared_with`.
+        template <typename T, typename... Args>
+        inline LocalShared<T> make_local_shared(Args&&... args) noexcept {
+            return make_shared_with<T, LocalRefCount>(std::forward<Args>(args)...);
+        }
+
+        static_assert(sizeof(Shared<int>) == sizeof(void*), "Shared must be pointer-sized.");
+    }
+}
+
+#endif
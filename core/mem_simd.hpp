@@ -0,0 +1,731 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file provides the vector kernels behind the trivially copyable paths of the `mem` range functions:
+ * broadcast fills and streaming copies for ranges larger than the cache, and the byte comparisons and element 
+ * searches behind the trivially comparable paths.
+ * Every kernel is compiled for its own instruction set and picked at runtime from `cpu::simd_level()`,
+ * so the library runs on any x86-64 CPU while using the widest registers available.
+ * 
+ * @file mem_simd.hpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#ifndef __GLX__CORE__MEM__SIMD__HPP__
+#define __GLX__CORE__MEM__SIMD__HPP__
+#include "basic_types.hpp"
+#include "cpu_features.hpp"
+#include <cstring>
+#include <cstdint>
+#include <atomic>
+#include <type_traits>
+#if defined(GLX_X86_SIMD)
+#include <immintrin.h>
+#endif
+
+namespace glx {
+    namespace mem {
+        /**
+         * How the trivially copyable paths of the copy functions move large ranges.
+         * @author ZhangKeyangZzz
+         */
+        enum CopyPolicy : uint8 {
+            AutoCopy      = 0,  /// Stream ranges of at least `streaming_threshold()` bytes, cache the others.
+            CachedCopy    = 1,  /// Always copy through the cache, the destination is about to be read.
+            StreamingCopy = 2,  /// Always bypass the cache, the destination won't be read soon.
+        };
+
+        namespace __ignore {
+            ///-------------------------------------------------------------------------------------
+            ///
+            /// Broadcast fill kernels.
+            ///
+            /// Each kernel fills `bytes` bytes at `dst` with a pattern of `period` bytes, where `period` divides 16
+            /// and `bytes` is a multiple of `period` no smaller than the vector width. `pattern` holds at least
+            /// `width + period` bytes of the repeated value. The head and the tail are written unaligned, and the 
+            /// body with aligned stores from a copy of the pattern rotated to the phase of the first aligned address.
+            ///
+            ///-------------------------------------------------------------------------------------
+#if defined(GLX_X86_SIMD)
+            __attribute__((target("sse2")))
+            inline void __fill_pattern_sse2(byte* dst, usize bytes, byte const* pattern, usize period) noexcept {
+                auto end  = dst + bytes;
+                auto ptr  = reinterpret_cast<byte*>((reinterpret_cast<uintptr_t>(dst) + 16) & ~uintptr_t(15));
+                auto head = _mm_loadu_si128(reinterpret_cast<__m128i const*>(pattern));
+                auto body = _mm_loadu_si128(reinterpret_cast<__m128i const*>(pattern + usize(ptr - dst) % period));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), head);
+                for (; ptr + 64 <= end; ptr += 64) {
+                    _mm_store_si128(reinterpret_cast<__m128i*>(ptr), body);
+                    _mm_store_si128(reinterpret_cast<__m128i*>(ptr + 16), body);
+                    _mm_store_si128(reinterpret_cast<__m128i*>(ptr + 32), body);
+                    _mm_store_si128(reinterpret_cast<__m128i*>(ptr + 48), body);
+                }
+                for (; ptr + 16 <= end; ptr += 16) {
+                    _mm_store_si128(reinterpret_cast<__m128i*>(ptr), body);
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(end - 16), head);
+            }
+
+            __attribute__((target("avx2")))
+            inline void __fill_pattern_avx2(byte* dst, usize bytes, byte const* pattern, usize period) noexcept {
+                auto end  = dst + bytes;
+                auto ptr  = reinterpret_cast<byte*>((reinterpret_cast<uintptr_t>(dst) + 32) & ~uintptr_t(31));
+                auto head = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(pattern));
+                auto body = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(pattern + usize(ptr - dst) % period));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), head);
+                for (; ptr + 128 <= end; ptr += 128) {
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(ptr), body);
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(ptr + 32), body);
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(ptr + 64), body);
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(ptr + 96), body);
+                }
+                for (; ptr + 32 <= end; ptr += 32) {
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(ptr), body);
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(end - 32), head);
+            }
+
+            __attribute__((target("avx512f")))
+            inline void __fill_pattern_avx512(byte* dst, usize bytes, byte const* pattern, usize period) noexcept {
+                auto end  = dst + bytes;
+                auto ptr  = reinterpret_cast<byte*>((reinterpret_cast<uintptr_t>(dst) + 64) & ~uintptr_t(63));
+                auto head = _mm512_loadu_si512(pattern);
+                auto body = _mm512_loadu_si512(pattern + usize(ptr - dst) % period);
+                _mm512_storeu_si512(dst, head);
+                for (; ptr + 256 <= end; ptr += 256) {
+                    _mm512_store_si512(ptr, body);
+                    _mm512_store_si512(ptr + 64, body);
+                    _mm512_store_si512(ptr + 128, body);
+                    _mm512_store_si512(ptr + 192, body);
+                }
+                for (; ptr + 64 <= end; ptr += 64) {
+                    _mm512_store_si512(ptr, body);
+                }
+                _mm512_storeu_si512(end - 64, head);
+            }
+#endif
+
+            ///-------------------------------------------------------------------------------------
+            ///
+            /// Streaming copy kernels.
+            ///
+            /// Each kernel copies `bytes` bytes from `src` to a non-overlapping `dst`, where `bytes` is at least 
+            /// `kStreamingMinBytes`. The destination is written with non-temporal stores, which go around the cache 
+            /// so a multi-megabyte copy doesn't evict the working set, while the source is prefetched 
+            /// `kPrefetchDistance` bytes ahead with a non-temporal hint for the same reason.
+            ///
+            ///-------------------------------------------------------------------------------------
+            constexpr usize kStreamingMinBytes = 4096;
+            constexpr usize kPrefetchDistance  = 1024;
+
+#if defined(GLX_X86_SIMD)
+            __attribute__((target("sse2")))
+            inline void __copy_stream_sse2(byte* dst, byte const* src, usize bytes) noexcept {
+                auto head = (16 - (reinterpret_cast<uintptr_t>(dst) & 15)) & 15;
+                memcpy(dst, src, head);
+                dst += head, src += head, bytes -= head;
+                for (; bytes >= 64; dst += 64, src += 64, bytes -= 64) {
+                    _mm_prefetch(reinterpret_cast<char const*>(src + kPrefetchDistance), _MM_HINT_NTA);
+                    auto v0 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src));
+                    auto v1 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + 16));
+                    auto v2 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + 32));
+                    auto v3 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + 48));
+                    _mm_stream_si128(reinterpret_cast<__m128i*>(dst), v0);
+                    _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 16), v1);
+                    _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 32), v2);
+                    _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 48), v3);
+                }
+                _mm_sfence();
+                memcpy(dst, src, bytes);
+            }
+
+            __attribute__((target("avx2")))
+            inline void __copy_stream_avx2(byte* dst, byte const* src, usize bytes) noexcept {
+                auto head = (32 - (reinterpret_cast<uintptr_t>(dst) & 31)) & 31;
+                memcpy(dst, src, head);
+                dst += head, src += head, bytes -= head;
+                for (; bytes >= 128; dst += 128, src += 128, bytes -= 128) {
+                    _mm_prefetch(reinterpret_cast<char const*>(src + kPrefetchDistance), _MM_HINT_NTA);
+                    _mm_prefetch(reinterpret_cast<char const*>(src + kPrefetchDistance + 64), _MM_HINT_NTA);
+                    auto v0 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(src));
+                    auto v1 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(src + 32));
+                    auto v2 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(src + 64));
+                    auto v3 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(src + 96));
+                    _mm256_stream_si256(reinterpret_cast<__m256i*>(dst), v0);
+                    _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + 32), v1);
+                    _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + 64), v2);
+                    _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + 96), v3);
+                }
+                _mm_sfence();
+                memcpy(dst, src, bytes);
+            }
+
+            __attribute__((target("avx512f")))
+            inline void __copy_stream_avx512(byte* dst, byte const* src, usize bytes) noexcept {
+                auto head = (64 - (reinterpret_cast<uintptr_t>(dst) & 63)) & 63;
+                memcpy(dst, src, head);
+                dst += head, src += head, bytes -= head;
+                for (; bytes >= 256; dst += 256, src += 256, bytes -= 256) {
+                    _mm_prefetch(reinterpret_cast<char const*>(src + kPrefetchDistance), _MM_HINT_NTA);
+                    _mm_prefetch(reinterpret_cast<char const*>(src + kPrefetchDistance + 64), _MM_HINT_NTA);
+                    _mm_prefetch(reinterpret_cast<char const*>(src + kPrefetchDistance + 128), _MM_HINT_NTA);
+                    _mm_prefetch(reinterpret_cast<char const*>(src + kPrefetchDistance + 192), _MM_HINT_NTA);
+                    auto v0 = _mm512_loadu_si512(src);
+                    auto v1 = _mm512_loadu_si512(src + 64);
+                    auto v2 = _mm512_loadu_si512(src + 128);
+                    auto v3 = _mm512_loadu_si512(src + 192);
+                    _mm512_stream_si512(reinterpret_cast<__m512i*>(dst), v0);
+                    _mm512_stream_si512(reinterpret_cast<__m512i*>(dst + 64), v1);
+                    _mm512_stream_si512(reinterpret_cast<__m512i*>(dst + 128), v2);
+                    _mm512_stream_si512(reinterpret_cast<__m512i*>(dst + 192), v3);
+                }
+                _mm_sfence();
+                memcpy(dst, src, bytes);
+            }
+#endif
+
+            /// Streaming pays off once a copy no longer fits next to the working set; default to 3/4 of the last level cache.
+            inline std::atomic<usize>& __streaming_threshold() noexcept {
+                static std::atomic<usize> threshold(cpu::last_level_cache_bytes() / 4 * 3);
+                return threshold;
+            }
+
+            /**
+             * Copy `bytes` bytes of trivially copyable objects from `src` to `dst`, which may overlap.
+             * Non-overlapping ranges are streamed when `policy` asks for it, or when it's `AutoCopy` and the
+             * range reaches the streaming threshold. Everything else is a `memmove`.
+             */
+            inline void __copy_trivial(void* dst, void const* src, usize bytes, CopyPolicy policy) noexcept {
+                auto dstPtr = reinterpret_cast<byte*>(dst);
+                auto srcPtr = reinterpret_cast<byte const*>(src);
+                if (policy == AutoCopy) {
+                    policy = bytes >= __streaming_threshold().load(std::memory_order_relaxed) ? StreamingCopy : CachedCopy;
+                }
+#if defined(GLX_X86_SIMD)
+                auto disjoint = dstPtr + bytes <= srcPtr || srcPtr + bytes <= dstPtr;
+                auto level    = cpu::simd_level();
+                if (policy == StreamingCopy && disjoint && bytes >= kStreamingMinBytes && level != cpu::Scalar) {
+                    if (level >= cpu::AVX512) {
+                        __copy_stream_avx512(dstPtr, srcPtr, bytes);
+                    } else if (level >= cpu::AVX2) {
+                        __copy_stream_avx2(dstPtr, srcPtr, bytes);
+                    } else {
+                        __copy_stream_sse2(dstPtr, srcPtr, bytes);
+                    }
+                    return;
+                }
+#endif
+                memmove(dstPtr, srcPtr, bytes);
+            }
+
+            /// Whether every byte of the object representation is the same, so the fill is a `memset`.
+            inline bool __is_byte_pattern(byte const* raw, usize size) noexcept {
+                for (usize i = 1; i < size; i++) {
+                    if (raw[i] != raw[0]) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            /// Fill `count` elements of a 1, 2, 4, 8 or 16 byte trivially copyable type through the widest kernel.
+            template <typename T>
+            void __fill_trivial_unchecked(T* dst, usize count, T const& value, std::true_type) noexcept {
+                auto raw   = reinterpret_cast<byte const*>(&value);
+                auto bytes = count * sizeof(T);
+                if (__is_byte_pattern(raw, sizeof(T))) {
+                    memset(dst, raw[0], bytes);
+                    return;
+                }
+#if defined(GLX_X86_SIMD)
+                auto level = cpu::simd_level();
+                if (level != cpu::Scalar && bytes >= 16) {
+                    alignas(64) byte pattern[128];
+                    for (usize i = 0; i < sizeof(pattern); i += sizeof(T)) {
+                        memcpy(pattern + i, raw, sizeof(T));
+                    }
+                    auto ptr = reinterpret_cast<byte*>(dst);
+                    if (level >= cpu::AVX512 && bytes >= 64) {
+                        __fill_pattern_avx512(ptr, bytes, pattern, sizeof(T));
+                    } else if (level >= cpu::AVX2 && bytes >= 32) {
+                        __fill_pattern_avx2(ptr, bytes, pattern, sizeof(T));
+                    } else {
+                        __fill_pattern_sse2(ptr, bytes, pattern, sizeof(T));
+                    }
+                    return;
+                }
+#endif
+                for (usize i = 0; i < count; i++) {
+                    memcpy(dst + i, raw, sizeof(T));
+                }
+            }
+
+            /// Other sizes do not tile a vector register; copy the object representation element by element.
+            template <typename T>
+            void __fill_trivial_unchecked(T* dst, usize count, T const& value, std::false_type) noexcept {
+                auto raw = reinterpret_cast<byte const*>(&value);
+                if (__is_byte_pattern(raw, sizeof(T))) {
+                    memset(dst, raw[0], count * sizeof(T));
+                    return;
+                }
+                for (usize i = 0; i < count; i++) {
+                    memcpy(dst + i, raw, sizeof(T));
+                }
+            }
+
+            /**
+             * Fill `count` elements of a trivially copyable type at `dst` with `value`.
+             * Byte patterns such as zero go to `memset`, other 1 to 16 byte power-of-two types to a vector kernel.
+             */
+            template <typename T>
+            void __fill_trivial(T* dst, usize count, T const& value) noexcept {
+                using IsVectorizable = std::integral_constant<bool, sizeof(T) <= 16 && 16 % sizeof(T) == 0>;
+                __fill_trivial_unchecked(dst, count, value, IsVectorizable());
+            }
+        }
+
+        namespace __ignore {
+            ///-------------------------------------------------------------------------------------
+            ///
+            /// Comparison kernels.
+            ///
+            /// Each kernel returns the offset of the first byte where `a` and `b` differ, or `bytes` if none does.
+            /// Four vectors are XORed per step and their union tested with a single branch, so equal prefixes run
+            /// at load bandwidth; the step holding the difference is searched again vector by vector.
+            ///
+            ///-------------------------------------------------------------------------------------
+            inline usize __mismatch_scalar(byte const* a, byte const* b, usize bytes) noexcept {
+                usize i = 0;
+                for (; i + 8 <= bytes; i += 8) {
+                    uint64 x, y;
+                    memcpy(&x, a + i, 8);
+                    memcpy(&y, b + i, 8);
+                    if (x != y) {
+                        break;
+                    }
+                }
+                for (; i < bytes && a[i] == b[i]; i++) {
+                }
+                return i;
+            }
+
+#if defined(GLX_X86_SIMD)
+            __attribute__((target("sse2")))
+            inline usize __mismatch_sse2(byte const* a, byte const* b, usize bytes) noexcept {
+                usize i = 0;
+                for (; i + 64 <= bytes; i += 64) {
+                    auto e0 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(a + i)), _mm_loadu_si128(reinterpret_cast<__m128i const*>(b + i)));
+                    auto e1 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(a + i + 16)), _mm_loadu_si128(reinterpret_cast<__m128i const*>(b + i + 16)));
+                    auto e2 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(a + i + 32)), _mm_loadu_si128(reinterpret_cast<__m128i const*>(b + i + 32)));
+                    auto e3 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(a + i + 48)), _mm_loadu_si128(reinterpret_cast<__m128i const*>(b + i + 48)));
+                    auto all = _mm_and_si128(_mm_and_si128(e0, e1), _mm_and_si128(e2, e3));
+                    if (_mm_movemask_epi8(all) != 0xffff) {
+                        break;
+                    }
+                }
+                for (; i + 16 <= bytes; i += 16) {
+                    auto eq   = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(a + i)), _mm_loadu_si128(reinterpret_cast<__m128i const*>(b + i)));
+                    auto diff = uint32(_mm_movemask_epi8(eq)) ^ 0xffffu;
+                    if (diff != 0) {
+                        return i + usize(__builtin_ctz(diff));
+                    }
+                }
+                return i + __mismatch_scalar(a + i, b + i, bytes - i);
+            }
+
+            __attribute__((target("avx2")))
+            inline usize __mismatch_avx2(byte const* a, byte const* b, usize bytes) noexcept {
+                usize i = 0;
+                if (bytes >= 256) {
+                    auto eq   = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(a)), _mm256_loadu_si256(reinterpret_cast<__m256i const*>(b)));
+                    auto diff = ~uint32(_mm256_movemask_epi8(eq));
+                    if (diff != 0) {
+                        return usize(__builtin_ctz(diff));
+                    }
+                    i = 32 - (reinterpret_cast<uintptr_t>(a) & 31);
+                }
+                for (; i + 128 <= bytes; i += 128) {
+                    auto d0  = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(a + i)), _mm256_loadu_si256(reinterpret_cast<__m256i const*>(b + i)));
+                    auto d1  = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(a + i + 32)), _mm256_loadu_si256(reinterpret_cast<__m256i const*>(b + i + 32)));
+                    auto d2  = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(a + i + 64)), _mm256_loadu_si256(reinterpret_cast<__m256i const*>(b + i + 64)));
+                    auto d3  = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(a + i + 96)), _mm256_loadu_si256(reinterpret_cast<__m256i const*>(b + i + 96)));
+                    auto any = _mm256_or_si256(_mm256_or_si256(d0, d1), _mm256_or_si256(d2, d3));
+                    if (!_mm256_testz_si256(any, any)) {
+                        break;
+                    }
+                }
+                for (; i + 32 <= bytes; i += 32) {
+                    auto eq   = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(a + i)), _mm256_loadu_si256(reinterpret_cast<__m256i const*>(b + i)));
+                    auto diff = ~uint32(_mm256_movemask_epi8(eq));
+                    if (diff != 0) {
+                        return i + usize(__builtin_ctz(diff));
+                    }
+                }
+                return i + __mismatch_sse2(a + i, b + i, bytes - i);
+            }
+
+            __attribute__((target("avx512f,avx512bw")))
+            inline usize __mismatch_avx512(byte const* a, byte const* b, usize bytes) noexcept {
+                usize i = 0;
+                if (bytes >= 512) {
+                    auto diff = uint64(_mm512_cmpneq_epi8_mask(_mm512_loadu_si512(a), _mm512_loadu_si512(b)));
+                    if (diff != 0) {
+                        return usize(__builtin_ctzll(diff));
+                    }
+                    i = 64 - (reinterpret_cast<uintptr_t>(a) & 63);
+                }
+                for (; i + 256 <= bytes; i += 256) {
+                    auto d0  = _mm512_xor_si512(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i));
+                    auto d1  = _mm512_xor_si512(_mm512_loadu_si512(a + i + 64), _mm512_loadu_si512(b + i + 64));
+                    auto d2  = _mm512_xor_si512(_mm512_loadu_si512(a + i + 128), _mm512_loadu_si512(b + i + 128));
+                    auto d3  = _mm512_xor_si512(_mm512_loadu_si512(a + i + 192), _mm512_loadu_si512(b + i + 192));
+                    auto any = _mm512_or_si512(_mm512_or_si512(d0, d1), _mm512_or_si512(d2, d3));
+                    if (_mm512_test_epi64_mask(any, any) != 0) {
+                        break;
+                    }
+                }
+                for (; i + 64 <= bytes; i += 64) {
+                    auto diff = uint64(_mm512_cmpneq_epi8_mask(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+                    if (diff != 0) {
+                        return i + usize(__builtin_ctzll(diff));
+                    }
+                }
+                return i + __mismatch_sse2(a + i, b + i, bytes - i);
+            }
+#endif
+
+            /// Return the offset of the first byte where `a` and `b` differ, or `bytes` if they are equal.
+            inline usize __mismatch_bytes(void const* a, void const* b, usize bytes) noexcept {
+                auto lhs = reinterpret_cast<byte const*>(a);
+                auto rhs = reinterpret_cast<byte const*>(b);
+#if defined(GLX_X86_SIMD)
+                auto level = cpu::simd_level();
+                if (level >= cpu::AVX512) {
+                    return __mismatch_avx512(lhs, rhs, bytes);
+                }
+                if (level >= cpu::AVX2) {
+                    return __mismatch_avx2(lhs, rhs, bytes);
+                }
+                if (level >= cpu::SSE2) {
+                    return __mismatch_sse2(lhs, rhs, bytes);
+                }
+#endif
+                return __mismatch_scalar(lhs, rhs, bytes);
+            }
+
+            ///-------------------------------------------------------------------------------------
+            ///
+            /// Search kernels.
+            ///
+            /// Each kernel looks for elements of `S` bytes, `S` being 1, 2, 4 or 8, equal to the first `S` bytes of
+            /// `pattern`, which holds the value repeated over at least 64 bytes. Vectors are compared byte by byte
+            /// and the byte mask is folded so that one bit remains per element whose bytes all matched, at the 
+            /// position of its first byte. `__find_*` returns the index of the first such element or `count`, 
+            /// `__count_*` the number of them.
+            ///
+            ///-------------------------------------------------------------------------------------
+            template <usize S>
+            inline uint64 __element_mask(uint64 bytes) noexcept {
+                if (S >= 2) {
+                    bytes &= bytes >> 1;
+                }
+                if (S >= 4) {
+                    bytes &= bytes >> 2;
+                }
+                if (S >= 8) {
+                    bytes &= bytes >> 4;
+                }
+                return S == 1 ? bytes : S == 2 ? bytes & 0x5555555555555555ull : S == 4 ? bytes & 0x1111111111111111ull : bytes & 0x0101010101010101ull;
+            }
+
+            /// Count the bits of `x` without the `popcnt` instruction, which SSE2-only CPUs lack.
+            inline uint32 __popcount(uint64 x) noexcept {
+                x = x - ((x >> 1) & 0x5555555555555555ull);
+                x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+                x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+                return uint32((x * 0x0101010101010101ull) >> 56);
+            }
+
+            template <usize S>
+            inline usize __find_scalar(byte const* ptr, usize count, byte const* pattern) noexcept {
+                for (usize i = 0; i < count; i++) {
+                    if (memcmp(ptr + i * S, pattern, S) == 0) {
+                        return i;
+                    }
+                }
+                return count;
+            }
+
+            template <usize S>
+            inline usize __count_scalar(byte const* ptr, usize count, byte const* pattern) noexcept {
+                usize found = 0;
+                for (usize i = 0; i < count; i++) {
+                    found += memcmp(ptr + i * S, pattern, S) == 0 ? 1 : 0;
+                }
+                return found;
+            }
+
+#if defined(GLX_X86_SIMD)
+            template <usize S>
+            __attribute__((target("sse2")))
+            inline usize __find_sse2(byte const* ptr, usize count, byte const* pattern) noexcept {
+                auto   needle = _mm_loadu_si128(reinterpret_cast<__m128i const*>(pattern));
+                auto   bytes  = count * S;
+                usize  i      = 0;
+                for (; i + 64 <= bytes; i += 64) {
+                    auto e0 = uint64(uint32(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr + i)), needle))));
+                    auto e1 = uint64(uint32(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr + i + 16)), needle))));
+                    auto e2 = uint64(uint32(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr + i + 32)), needle))));
+                    auto e3 = uint64(uint32(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr + i + 48)), needle))));
+                    auto found = __element_mask<S>(e0 | e1 << 16 | e2 << 32 | e3 << 48);
+                    if (found != 0) {
+                        return (i + usize(__builtin_ctzll(found))) / S;
+                    }
+                }
+                for (; i + 16 <= bytes; i += 16) {
+                    auto found = __element_mask<S>(uint32(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr + i)), needle))));
+                    if (found != 0) {
+                        return (i + usize(__builtin_ctzll(found))) / S;
+                    }
+                }
+                return i / S + __find_scalar<S>(ptr + i, count - i / S, pattern);
+            }
+
+            template <usize S>
+            __attribute__((target("sse2")))
+            inline usize __count_sse2(byte const* ptr, usize count, byte const* pattern) noexcept {
+                auto  needle = _mm_loadu_si128(reinterpret_cast<__m128i const*>(pattern));
+                auto  bytes  = count * S;
+                usize i      = 0;
+                usize found  = 0;
+                for (; i + 64 <= bytes; i += 64) {
+                    auto e0 = uint64(uint32(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr + i)), needle))));
+                    auto e1 = uint64(uint32(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr + i + 16)), needle))));
+                    auto e2 = uint64(uint32(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr + i + 32)), needle))));
+                    auto e3 = uint64(uint32(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr + i + 48)), needle))));
+                    found += __popcount(__element_mask<S>(e0 | e1 << 16 | e2 << 32 | e3 << 48));
+                }
+                return found + __count_scalar<S>(ptr + i, count - i / S, pattern);
+            }
+
+            /// The element mask of the 64 bytes compared by `lo` and `hi`.
+            template <usize S>
+            __attribute__((target("avx2")))
+            inline uint64 __element_mask_avx2(__m256i lo, __m256i hi) noexcept {
+                return __element_mask<S>(uint64(uint32(_mm256_movemask_epi8(lo))) | uint64(uint32(_mm256_movemask_epi8(hi))) << 32);
+            }
+
+            template <usize S>
+            __attribute__((target("avx2,popcnt")))
+            inline usize __find_avx2(byte const* ptr, usize count, byte const* pattern) noexcept {
+                auto  needle = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(pattern));
+                auto  bytes  = count * S;
+                usize i      = 0;
+                if (bytes >= 256) {
+                    auto found = __element_mask<S>(uint32(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr)), needle))));
+                    if (found != 0) {
+                        return usize(__builtin_ctzll(found)) / S;
+                    }
+                    i = (32 - (reinterpret_cast<uintptr_t>(ptr) & 31)) / S * S;
+                }
+                for (; i + 128 <= bytes; i += 128) {
+                    auto e0  = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr + i)), needle);
+                    auto e1  = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr + i + 32)), needle);
+                    auto e2  = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr + i + 64)), needle);
+                    auto e3  = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr + i + 96)), needle);
+                    auto any = _mm256_or_si256(_mm256_or_si256(e0, e1), _mm256_or_si256(e2, e3));
+                    if (_mm256_testz_si256(any, any)) {
+                        continue;
+                    }
+                    // A byte matched; wider elements need all their bytes to.
+                    auto found = __element_mask_avx2<S>(e0, e1);
+                    if (found != 0) {
+                        return (i + usize(__builtin_ctzll(found))) / S;
+                    }
+                    found = __element_mask_avx2<S>(e2, e3);
+                    if (found != 0) {
+                        return (i + 64 + usize(__builtin_ctzll(found))) / S;
+                    }
+                }
+                for (; i + 64 <= bytes; i += 64) {
+                    auto e0    = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr + i)), needle);
+                    auto e1    = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr + i + 32)), needle);
+                    auto found = __element_mask_avx2<S>(e0, e1);
+                    if (found != 0) {
+                        return (i + usize(__builtin_ctzll(found))) / S;
+                    }
+                }
+                return i / S + __find_sse2<S>(ptr + i, count - i / S, pattern);
+            }
+
+            template <usize S>
+            __attribute__((target("avx2,popcnt")))
+            inline usize __count_avx2(byte const* ptr, usize count, byte const* pattern) noexcept {
+                auto  needle = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(pattern));
+                auto  bytes  = count * S;
+                usize i      = 0;
+                usize found  = 0;
+                if (bytes >= 256) {
+                    i     = (32 - (reinterpret_cast<uintptr_t>(ptr) & 31)) / S * S;
+                    found = __count_scalar<S>(ptr, i / S, pattern);
+                }
+                for (; i + 128 <= bytes; i += 128) {
+                    auto e0 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr + i)), needle);
+                    auto e1 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr + i + 32)), needle);
+                    auto e2 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr + i + 64)), needle);
+                    auto e3 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr + i + 96)), needle);
+                    found += usize(__builtin_popcountll(__element_mask_avx2<S>(e0, e1)));
+                    found += usize(__builtin_popcountll(__element_mask_avx2<S>(e2, e3)));
+                }
+                for (; i + 64 <= bytes; i += 64) {
+                    auto e0 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr + i)), needle);
+                    auto e1 = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr + i + 32)), needle);
+                    found += usize(__builtin_popcountll(__element_mask_avx2<S>(e0, e1)));
+                }
+                return found + __count_scalar<S>(ptr + i, count - i / S, pattern);
+            }
+
+            template <usize S>
+            __attribute__((target("avx512f,avx512bw,popcnt")))
+            inline usize __find_avx512(byte const* ptr, usize count, byte const* pattern) noexcept {
+                auto  needle = _mm512_loadu_si512(pattern);
+                auto  bytes  = count * S;
+                usize i      = 0;
+                if (bytes >= 512) {
+                    auto found = __element_mask<S>(uint64(_mm512_cmpeq_epi8_mask(_mm512_loadu_si512(ptr), needle)));
+                    if (found != 0) {
+                        return usize(__builtin_ctzll(found)) / S;
+                    }
+                    i = (64 - (reinterpret_cast<uintptr_t>(ptr) & 63)) / S * S;
+                }
+                for (; i + 256 <= bytes; i += 256) {
+                    auto e0 = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(ptr + i), needle);
+                    auto e1 = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(ptr + i + 64), needle);
+                    auto e2 = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(ptr + i + 128), needle);
+                    auto e3 = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(ptr + i + 192), needle);
+                    if ((__element_mask<S>(e0) | __element_mask<S>(e1) | __element_mask<S>(e2) | __element_mask<S>(e3)) != 0) {
+                        break;
+                    }
+                }
+                for (; i + 64 <= bytes; i += 64) {
+                    auto found = __element_mask<S>(uint64(_mm512_cmpeq_epi8_mask(_mm512_loadu_si512(ptr + i), needle)));
+                    if (found != 0) {
+                        return (i + usize(__builtin_ctzll(found))) / S;
+                    }
+                }
+                return i / S + __find_sse2<S>(ptr + i, count - i / S, pattern);
+            }
+
+            template <usize S>
+            __attribute__((target("avx512f,avx512bw,popcnt")))
+            inline usize __count_avx512(byte const* ptr, usize count, byte const* pattern) noexcept {
+                auto  needle = _mm512_loadu_si512(pattern);
+                auto  bytes  = count * S;
+                usize i      = 0;
+                usize found  = 0;
+                if (bytes >= 512) {
+                    i      = (64 - (reinterpret_cast<uintptr_t>(ptr) & 63)) / S * S;
+                    found  = __count_scalar<S>(ptr, i / S, pattern);
+                }
+                for (; i + 64 <= bytes; i += 64) {
+                    found += usize(__builtin_popcountll(__element_mask<S>(uint64(_mm512_cmpeq_epi8_mask(_mm512_loadu_si512(ptr + i), needle)))));
+                }
+                return found + __count_scalar<S>(ptr + i, count - i / S, pattern);
+            }
+#endif
+
+            /// Repeat the `S` bytes of `value` over the 64 bytes of `pattern`.
+            template <usize S>
+            inline void __broadcast_pattern(byte* pattern, void const* value) noexcept {
+                for (usize i = 0; i < 64; i += S) {
+                    memcpy(pattern + i, value, S);
+                }
+            }
+
+            /// Return the index of the first of `count` elements of `S` bytes at `ptr` equal to `value`, or `count`.
+            template <usize S>
+            inline usize __find_trivial(void const* ptr, usize count, void const* value) noexcept {
+                alignas(64) byte pattern[64];
+                __broadcast_pattern<S>(pattern, value);
+                auto data = reinterpret_cast<byte const*>(ptr);
+#if defined(GLX_X86_SIMD)
+                auto level = cpu::simd_level();
+                if (level >= cpu::AVX512) {
+                    return __find_avx512<S>(data, count, pattern);
+                }
+                if (level >= cpu::AVX2) {
+                    return __find_avx2<S>(data, count, pattern);
+                }
+                if (level >= cpu::SSE2) {
+                    return __find_sse2<S>(data, count, pattern);
+                }
+#endif
+                return __find_scalar<S>(data, count, pattern);
+            }
+
+            /// Return the number of the `count` elements of `S` bytes at `ptr` equal to `value`.
+            template <usize S>
+            inline usize __count_trivial(void const* ptr, usize count, void const* value) noexcept {
+                alignas(64) byte pattern[64];
+                __broadcast_pattern<S>(pattern, value);
+                auto data = reinterpret_cast<byte const*>(ptr);
+#if defined(GLX_X86_SIMD)
+                auto level = cpu::simd_level();
+                if (level >= cpu::AVX512) {
+                    return __count_avx512<S>(data, count, pattern);
+                }
+                if (level >= cpu::AVX2) {
+                    return __count_avx2<S>(data, count, pattern);
+                }
+                if (level >= cpu::SSE2) {
+                    return __count_sse2<S>(data, count, pattern);
+                }
+#endif
+                return __count_scalar<S>(data, count, pattern);
+            }
+        }
+
+        /**
+         * Return the size in bytes from which `AutoCopy` copies bypass the cache.
+         * @author ZhangKeyangZzz
+         */
+        inline usize streaming_threshold() noexcept {
+            return __ignore::__streaming_threshold().load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Replace the size in bytes from which `AutoCopy` copies bypass the cache. Calibrated at startup
+         * to 3/4 of the last level cache; pass `usize(-1)` to never stream automatically.
+         * @author ZhangKeyangZzz
+         * @param[in] bytes The new threshold.
+         */
+        inline void set_streaming_threshold(usize bytes) noexcept {
+            __ignore::__streaming_threshold().store(bytes, std::memory_order_relaxed);
+        }
+    }
+}
+
+#endif
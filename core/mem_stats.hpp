@@ -0,0 +1,226 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/**
+ * This file provides allocation statistics for the pool behind `mem::allocate`: `mem::stats`, 
+ * `mem::register_tag` and `mem::TagScope`.
+ * 
+ * @file mem_stats.hpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#ifndef __GLX__CORE__MEM__STATS__HPP__
+#define __GLX__CORE__MEM__STATS__HPP__
+#include "mem_allocator.hpp"
+#include "Uncopyable.hpp"
+#include <cstring>
+
+namespace glx {
+    namespace mem {
+        /// The number of histogram buckets: one per size class, then large, aligned and huge blocks. The aligned bucket
+        /// stays empty, an aligned block is counted as the block it was carved from.
+        constexpr usize kStatsBucketCount = __ignore::kStatBuckets;
+
+        /// The number of tags, including the untagged tag 0.
+        constexpr usize kStatsTagCount = __ignore::kMaxTags;
+
+        /// The longest tag name kept, including the terminating zero.
+        constexpr usize kStatsTagNameBytes = 32;
+
+        /// Counters of one size class or one tag.
+        struct AllocationCounters {
+            uint64 allocations    = 0;
+            uint64 frees          = 0;
+            uint64 allocatedBytes = 0;
+            uint64 freedBytes     = 0;
+        };
+
+        /// One bucket of the size histogram.
+        struct SizeClassStats : AllocationCounters {
+            usize blockBytes = 0;   /// The block size of the class, or 0 for the last three buckets.
+        };
+
+        /// The counters of one tag registered by `register_tag`.
+        struct TagStats : AllocationCounters {
+            char name[kStatsTagNameBytes] = {};
+        };
+
+        /**
+         * A snapshot of the pool statistics returned by `stats`. Small blocks count the bytes of their size class,
+         * large blocks the requested bytes and huge blocks the mapped bytes, so the byte totals are what the pool
+         * actually holds for the caller.
+         * @author ZhangKeyangZzz
+         */
+        struct AllocationStats : AllocationCounters {
+            int64          liveBytes = 0;               /// Bytes allocated and not yet freed.
+            int64          peakBytes = 0;               /// The highest `liveBytes` seen, see the note on `stats`.
+            SizeClassStats classes[kStatsBucketCount];  /// The size histogram.
+            TagStats       tags[kStatsTagCount];        /// Indexed by tag id, tag 0 holds untagged allocations.
+            usize          tagCount = 0;                /// The number of valid entries of `tags`.
+        };
+
+        namespace __ignore {
+            struct TagRegistry {
+                std::mutex _lock;
+                usize      _count = 1;
+                char       _names[kStatsTagCount][kStatsTagNameBytes] = { "untagged" };
+            };
+
+            inline TagRegistry& __tag_registry() noexcept {
+                static typename std::aligned_storage<sizeof(TagRegistry), alignof(TagRegistry)>::type storage;
+                static TagRegistry* registry = new (&storage) TagRegistry();
+                return *registry;
+            }
+
+            inline void __accumulate(AllocationCounters& to, const StatCounter& allocations, const StatCounter& frees, 
+                    const StatCounter& allocatedBytes, const StatCounter& freedBytes) noexcept {
+                to.allocations    += allocations.load();
+                to.frees          += frees.load();
+                to.allocatedBytes += allocatedBytes.load();
+                to.freedBytes     += freedBytes.load();
+            }
+
+            inline void __accumulate_tags(AllocationStats& to, const ThreadStats& from) noexcept {
+                for (usize i = 0; i < kStatsTagCount; i++) {
+                    __accumulate(to.tags[i], from.tagAllocations[i], from.tagFrees[i], from.tagAllocatedBytes[i], from.tagFreedBytes[i]);
+                }
+            }
+
+            inline void __accumulate(AllocationStats& to, const ThreadStats& from) noexcept {
+                for (usize i = 0; i < kStatsBucketCount; i++) {
+                    __accumulate(to.classes[i], from.allocations[i], from.frees[i], from.allocatedBytes[i], from.freedBytes[i]);
+                }
+                __accumulate_tags(to, from);
+            }
+
+            inline void __accumulate(AllocationStats& to, const ThreadCache& from) noexcept {
+                for (uint32 i = 0; i < kStatsBucketCount; i++) {
+                    auto& bucket = to.classes[i];
+                    bucket.allocations    += from.allocations(i);
+                    bucket.frees          += from.frees(i);
+                    bucket.allocatedBytes += from.stats.allocatedBytes[i].load();
+                    bucket.freedBytes     += from.stats.freedBytes[i].load();
+                }
+                __accumulate_tags(to, from.stats);
+            }
+        }
+
+        /**
+         * Register a tag for allocation statistics.
+         * @author ZhangKeyangZzz
+         * @param[in] name The name reported by `stats`, truncated to `kStatsTagNameBytes - 1` characters.
+         * @return Returns the tag id, or 0 (untagged) if `name` is null or every tag is taken.
+         * @note Registering the same name twice returns the same id.
+         */
+        inline uint16 register_tag(const char* name) noexcept {
+            if (name == nullptr) {
+                return 0;
+            }
+            auto& registry = __ignore::__tag_registry();
+            std::lock_guard<std::mutex> guard(registry._lock);
+            for (usize i = 1; i < registry._count; i++) {
+                if (std::strncmp(registry._names[i], name, kStatsTagNameBytes - 1) == 0) {
+                    return uint16(i);
+                }
+            }
+            if (registry._count == kStatsTagCount) {
+                return 0;
+            }
+            auto id = registry._count++;
+            std::strncpy(registry._names[id], name, kStatsTagNameBytes - 1);
+            return uint16(id);
+        }
+
+        /**
+         * `TagScope` charges every block allocated by the calling thread to `tag` while it is alive,
+         * and restores the previous tag on destruction.
+         * @author ZhangKeyangZzz
+         */
+        class TagScope : public Uncopyable {
+            uint16 _previous;
+
+        public:
+            explicit TagScope(uint16 tag) noexcept : _previous(__ignore::__tls_tag()) {
+                __ignore::__tls_tag() = tag < kStatsTagCount ? tag : 0;
+            }
+
+            ~TagScope() noexcept {
+                __ignore::__tls_tag() = _previous;
+            }
+        };
+
+        /**
+         * Take a snapshot of the allocation statistics of every thread.
+         * @author ZhangKeyangZzz
+         * @return Returns the statistics. Everything is zero when built with `GLX_MEM_STATS=0`.
+         * @note Threads count on their own and are summed here, so a snapshot taken while other threads allocate
+         *       is not atomic. `peakBytes` is sampled whenever a thread goes to the central cache or the system, 
+         *       so it can miss a peak by about what the thread caches hold.
+         */
+        inline AllocationStats stats() noexcept {
+            AllocationStats result;
+            __ignore::__cache_registry().for_each([&](const __ignore::ThreadCache& cache) {
+                __ignore::__accumulate(result, cache);
+            });
+            __ignore::__accumulate(result, __ignore::__orphan_stats());
+            for (usize i = 0; i < kStatsBucketCount; i++) {
+                auto& bucket = result.classes[i];
+                if (i < __ignore::kSizeClassCount) {
+                    bucket.blockBytes     = __ignore::__class_to_size(uint32(i));
+                    bucket.allocatedBytes = bucket.allocations * bucket.blockBytes;
+                    bucket.freedBytes     = bucket.frees * bucket.blockBytes;
+                }
+                result.allocations    += bucket.allocations;
+                result.frees          += bucket.frees;
+                result.allocatedBytes += bucket.allocatedBytes;
+                result.freedBytes     += bucket.freedBytes;
+            }
+            auto& untagged = result.tags[0];
+            untagged = TagStats();
+            static_cast<AllocationCounters&>(untagged) = result;
+            for (usize i = 1; i < kStatsTagCount; i++) {
+                untagged.allocations    -= result.tags[i].allocations;
+                untagged.frees          -= result.tags[i].frees;
+                untagged.allocatedBytes -= result.tags[i].allocatedBytes;
+                untagged.freedBytes     -= result.tags[i].freedBytes;
+            }
+            {
+                auto& registry = __ignore::__tag_registry();
+                std::lock_guard<std::mutex> guard(registry._lock);
+                result.tagCount = registry._count;
+                for (usize i = 0; i < registry._count; i++) {
+                    std::memcpy(result.tags[i].name, registry._names[i], kStatsTagNameBytes);
+                }
+            }
+            result.liveBytes = int64(result.allocatedBytes - result.freedBytes);
+            auto peak = __ignore::__peak_bytes().load(std::memory_order_relaxed);
+            result.peakBytes = peak > result.liveBytes ? peak : result.liveBytes;
+            return result;
+        }
+    }
+}
+
+#endif
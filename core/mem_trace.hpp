@@ -0,0 +1,119 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file provides the allocation trace of the pool behind `mem::allocate`: `mem::start_trace` and 
+ * `mem::stop_trace`.
+ * 
+ * While tracing, every allocation and free records its size, thread, time and block into a buffer owned by the
+ * calling thread, which is appended to the trace file with a single `write` when full. The file is a 
+ * `TraceFileHeader` followed by `TraceRecord`s in native byte order, sorted by time within each thread only.
+ * `tools/trace_replay` runs a trace again against other allocators to compare them on a real workload.
+ * 
+ * @file mem_trace.hpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#ifndef __GLX__CORE__MEM__TRACE__HPP__
+#define __GLX__CORE__MEM__TRACE__HPP__
+#include "mem_allocator.hpp"
+#include "status_code.hpp"
+
+namespace glx {
+    namespace mem {
+        using TraceRecord     = __ignore::TraceRecord;
+        using TraceFileHeader = __ignore::TraceHeader;
+        using __ignore::kTraceAllocate;
+        using __ignore::kTraceFree;
+        using __ignore::kTraceVersion;
+
+        /**
+         * Start recording allocations and frees to `path`.
+         * @author ZhangKeyangZzz
+         * @param[in] path The file to create or overwrite.
+         * @return Returns `Success`, `IllegalArgument` if `path` is null, `IllegalState` if a trace is already 
+         *         running, or `IOError` if the file can't be created.
+         * @note Does nothing and returns `IllegalState` when built with `GLX_MEM_TRACE=0`. Blocks of 
+         *       `allocate_huge` and `ObjectPool` are not traced; aligned blocks are traced as the larger block they
+         *       are carved from.
+         */
+        inline int start_trace(const char* path) noexcept {
+            if (path == nullptr) {
+                return StatusCode::IllegalArgument;
+            }
+#if GLX_MEM_TRACE && defined(__linux__)
+            auto& session = __ignore::__trace_session();
+            std::lock_guard<std::mutex> guard(session.control);
+            if (__ignore::__trace_enabled().load()) {
+                return StatusCode::IllegalState;
+            }
+            auto file = ::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0644);
+            if (file < 0) {
+                return StatusCode::IOError;
+            }
+            TraceFileHeader header = { { 'G', 'L', 'X', 'T', 'R', 'A', 'C', 'E' }, kTraceVersion, uint32(sizeof(TraceRecord)) };
+            if (::write(file, &header, sizeof(header)) != ssize_t(sizeof(header))) {
+                ::close(file);
+                return StatusCode::IOError;
+            }
+            session.fd.store(file, std::memory_order_relaxed);
+            session.start.store(__ignore::__trace_clock(), std::memory_order_relaxed);
+            __ignore::__trace_enabled().store(true);
+            return StatusCode::Success;
+#else
+            return StatusCode::IllegalState;
+#endif
+        }
+
+        /**
+         * Stop recording, write out what every thread still holds and close the file.
+         * @author ZhangKeyangZzz
+         * @return Returns `Success`, `IllegalState` if no trace is running, or `IOError` if the file can't be closed.
+         * @note Waits for threads in the middle of recording, which takes no longer than one `write`.
+         */
+        inline int stop_trace() noexcept {
+#if GLX_MEM_TRACE && defined(__linux__)
+            auto& session = __ignore::__trace_session();
+            std::lock_guard<std::mutex> guard(session.control);
+            if (!__ignore::__trace_enabled().load()) {
+                return StatusCode::IllegalState;
+            }
+            __ignore::__trace_enabled().store(false);
+            session.drain();
+            auto file = session.fd.exchange(-1, std::memory_order_relaxed);
+            return ::close(file) == 0 ? StatusCode::Success : StatusCode::IOError;
+#else
+            return StatusCode::IllegalState;
+#endif
+        }
+
+        /// Return whether allocations are being traced.
+        inline bool tracing() noexcept {
+            return __ignore::__trace_enabled().load(std::memory_order_relaxed);
+        }
+    }
+}
+
+#endif
@@ -34,6 +34,8 @@
 #define __GLX__CORE__MEM__UTILITIES__HPP__
 #include "basic_types.hpp"
 #include "status_code.hpp"
+#include "mem_allocator.hpp"
+#include "mem_simd.hpp"
 #include <new>
 #include <utility>
 #include <cstdlib>
@@ -43,28 +45,210 @@ namespace glx {
     namespace mem {
         /**
          * Allocate a contiguous block of heap memory to hold at least ```count``` elements.
+         * The block comes from the size-class pool in `mem_allocator.hpp`: small blocks are served from
+         * a per-thread cache without locking, large blocks go straight to the system heap.
          * @author ZhangKeyangZzz
          * @param[in] count The specified elements count.
          * @tparam T The type of elements in both array.
-         * @return Returns the address of the block.
-         * @note If some errors is ocurred, throws the std::bad_alloc exception.
+         * @return Returns the address of the block, aligned to at least `alignof(T)`.
+         * @note If the memory or the budget of the current tag is exhausted, returns nullptr; `try_allocate` tells
+         *       the two apart from a bad `count`.
          */
         template <typename T>
         inline T* allocate(usize count) noexcept {
+            if (count > usize(-1) / sizeof(T)) {
+                return nullptr;
+            }
             auto totalBytes = usize(count * sizeof(T));
-            auto ptr        = new byte[totalBytes];
+            auto ptr        = alignof(T) > __ignore::kBlockHeaderBytes
+                            ? __ignore::__aligned_allocate(totalBytes, alignof(T))
+                            : __ignore::__pool_allocate(totalBytes);
             return reinterpret_cast<T*>(ptr);
         }
 
+        /**
+         * Allocate a contiguous block of heap memory to hold at least ```count``` elements, reporting why it failed.
+         * @author ZhangKeyangZzz
+         * @param[out] result Receives the address of the block, or nullptr on failure.
+         * @param[in] count The specified elements count.
+         * @tparam T The type of elements in the array.
+         * @return Returns `Success`, `IllegalArgument` if `count` elements don't fit in the address space, or 
+         *         `OutOfMemory` if the system or the budget of the current tag (see `mem::set_budget`) has no room.
+         */
+        template <typename T>
+        inline int try_allocate(T*& result, usize count) noexcept {
+            if (count > usize(-1) / sizeof(T)) {
+                result = nullptr;
+                return StatusCode::IllegalArgument;
+            }
+            result = allocate<T>(count);
+            return result != nullptr ? StatusCode::Success : StatusCode::OutOfMemory;
+        }
+
+        /**
+         * Allocate a contiguous block of heap memory to hold at least ```count``` elements with every byte zero.
+         * Large blocks come from pages fresh from the system whenever possible, which are zero already, so only
+         * recycled memory is cleared; that is one pass over the block less than `allocate` plus a fill.
+         * @author ZhangKeyangZzz
+         * @param[in] count The specified elements count.
+         * @tparam T The type of elements in the array.
+         * @return Returns the address of the block, or nullptr if the memory is exhausted.
+         * @note No constructor is run; all-zero bytes are the zero value of integers, floats and pointers.
+         */
+        template <typename T>
+        inline T* allocate_zeroed(usize count) noexcept {
+            if (count > usize(-1) / sizeof(T)) {
+                return nullptr;
+            }
+            auto align = alignof(T) > __ignore::kBlockHeaderBytes ? alignof(T) : __ignore::kBlockHeaderBytes;
+            return reinterpret_cast<T*>(__ignore::__zeroed_allocate(count * sizeof(T), align));
+        }
+
+        /**
+         * Allocate a contiguous block of heap memory to hold at least ```count``` elements at an address
+         * that is a multiple of `align`.
+         * @author ZhangKeyangZzz
+         * @param[in] count The specified elements count.
+         * @param[in] align The alignment, a power of two no larger than `kHugePageBytes`.
+         * @tparam T The type of elements in the array.
+         * @return Returns the address of the block, or nullptr if `align` is invalid or the memory is exhausted.
+         * @note The block is released by `deallocate` like any other.
+         */
+        template <typename T>
+        inline T* allocate_aligned(usize count, usize align) noexcept {
+            if (align == 0 || (align & (align - 1)) != 0 || count > usize(-1) / sizeof(T)) {
+                return nullptr;
+            }
+            if (align < alignof(T)) {
+                align = alignof(T);
+            }
+            return reinterpret_cast<T*>(__ignore::__aligned_allocate(count * sizeof(T), align));
+        }
+
+        /**
+         * Allocate a block for ```count``` elements that starts on a cache line and whose size is rounded
+         * up to whole cache lines, so no other allocation ever shares a line with it.
+         * @author ZhangKeyangZzz
+         * @param[in] count The specified elements count.
+         * @tparam T The type of elements in the array.
+         * @return Returns the address of the block, or nullptr if the memory is exhausted.
+         * @note To keep the elements themselves apart, allocate `CachePadded<T>` instead.
+         */
+        template <typename T>
+        inline T* allocate_cache_aligned(usize count) noexcept {
+            if (count > (usize(-1) - kCacheLineBytes) / sizeof(T)) {
+                return nullptr;
+            }
+            auto totalBytes = (count * sizeof(T) + kCacheLineBytes - 1) & ~(kCacheLineBytes - 1);
+            auto align      = alignof(T) > kCacheLineBytes ? alignof(T) : kCacheLineBytes;
+            return reinterpret_cast<T*>(__ignore::__aligned_allocate(totalBytes, align));
+        }
+
+        /**
+         * Allocate a large block for ```count``` elements from a fresh mapping aligned to `kHugePageBytes` 
+         * and advised to be backed by transparent huge pages, which cuts TLB misses on big tables.
+         * Falls back to a cache-line-aligned block where huge pages are unavailable.
+         * @author ZhangKeyangZzz
+         * @param[in] count The specified elements count.
+         * @tparam T The type of elements in the array.
+         * @return Returns the address of the block, aligned to `kCacheLineBytes`, or nullptr if the memory is exhausted.
+         * @note Only worth it for blocks of several megabytes; every call maps whole huge pages.
+         */
+        template <typename T>
+        inline T* allocate_huge(usize count) noexcept {
+            static_assert(alignof(T) <= kCacheLineBytes, "allocate_huge only guarantees cache line alignment.");
+            if (count > usize(-1) / sizeof(T)) {
+                return nullptr;
+            }
+            return reinterpret_cast<T*>(__ignore::__huge_allocate(count * sizeof(T)));
+        }
+
+        /// Return the count of NUMA nodes, 1 on a single-node machine or where the system doesn't tell.
+        inline usize numa_node_count() noexcept {
+            return __ignore::__numa_node_count();
+        }
+
+        /// Return the NUMA node of the CPU the calling thread runs on right now, 0 on a single-node machine.
+        inline uint32 current_numa_node() noexcept {
+            return __ignore::__current_node();
+        }
+
+        /**
+         * Allocate a block for ```count``` elements whose pages are placed on NUMA node `node` instead of the node 
+         * of the thread that happens to touch them first. The pool already keeps a central cache per node, so small
+         * blocks allocated by a thread come from its own node; this is for buffers prepared by one thread and 
+         * worked on by threads of another node.
+         * @author ZhangKeyangZzz
+         * @param[in] count The specified elements count.
+         * @param[in] node The node, below `numa_node_count()`; any value on a single-node machine.
+         * @tparam T The type of elements in the array.
+         * @return Returns the address of the block, or nullptr if `node` is invalid or the memory is exhausted.
+         * @note Every block takes whole pages, so prefer an `Arena` bound to the node for small objects. The kernel 
+         *       falls back to other nodes once `node` is full. On a single-node machine this is `allocate`,
+         *       so code written for several nodes runs unchanged.
+         *       The block is released by `deallocate(ptr)` like any other.
+         */
+        template <typename T>
+        inline T* allocate_on_node(usize count, uint32 node) noexcept {
+            if (count > usize(-1) / sizeof(T) || (numa_node_count() > 1 && node >= numa_node_count())) {
+                return nullptr;
+            }
+            static_assert(alignof(T) <= __ignore::kBlockHeaderBytes, "allocate_on_node only guarantees 16-byte alignment.");
+            return reinterpret_cast<T*>(__ignore::__node_allocate(count * sizeof(T), node));
+        }
+
+        /**
+         * Set the size from which `allocate` maps blocks straight from the system instead of taking them from the 
+         * system heap. Such a block is unmapped as soon as it is deallocated and is grown by `reallocate` without 
+         * copying. Blocks already allocated keep their kind.
+         * @author ZhangKeyangZzz
+         * @param[in] bytes The threshold in bytes, `kDefaultMapThreshold` initially; `usize(-1)` never maps.
+         * @note Only mapped on Linux. Values below 32 KB behave as 32 KB, smaller blocks always come from the pool.
+         */
+        inline void set_map_threshold(usize bytes) noexcept {
+            __ignore::__map_threshold().store(bytes, std::memory_order_relaxed);
+        }
+
+        /// Return the size from which `allocate` maps blocks, see `set_map_threshold`.
+        inline usize map_threshold() noexcept {
+            return __ignore::__map_threshold().load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Wraps a value into its own cache line. An array of `CachePadded<T>` never has two elements 
+         * on one line, which removes false sharing between per-thread counters.
+         * @tparam T The type of the wrapped value.
+         */
+        template <typename T>
+        struct alignas(kCacheLineBytes) CachePadded {
+            T value;
+        };
+
         /**
          * Deallocate a contiguous block of heap memory.
          * @author ZhangKeyangZzz
          * @param[in] ptr The the address of the block.
-         * @tparam T The type of elements in both array.
+         * @note The block must be returned by one of the `allocate` functions. It may be released on any thread.
          */
         inline void deallocate(void* ptr) noexcept {
-            auto rawPtr = reinterpret_cast<byte*>(ptr);
-            delete[] rawPtr;
+            if (ptr != nullptr) {
+                __ignore::__pool_deallocate(ptr);
+            }
+        }
+
+        /**
+         * Deallocate a contiguous block of heap memory whose size the caller knows. The size class is computed 
+         * from `bytes` instead of read from the block header, which takes a dependent load off the free path.
+         * @author ZhangKeyangZzz
+         * @param[in] ptr The the address of the block.
+         * @param[in] bytes The bytes requested when the block was allocated, `count * sizeof(T)` for `allocate<T>`.
+         * @note Only for blocks returned by `allocate` for a type with `alignof(T) <= 16`. Blocks of the other
+         *       `allocate_*` functions must be released by `deallocate(ptr)`.
+         */
+        inline void deallocate(void* ptr, usize bytes) noexcept {
+            if (ptr != nullptr) {
+                __ignore::__pool_deallocate_sized(ptr, bytes);
+            }
         }
 
         /**
@@ -76,7 +260,7 @@ namespace glx {
          */
         template <typename T, typename... Args>
         void construct(T* object, Args&&... args) noexcept {
-            new (object) T(std::forward<Args>(args)...);
+            ::new (static_cast<void*>(object)) T(std::forward<Args>(args)...);
         }
 
         /**
@@ -90,6 +274,55 @@ namespace glx {
             object->~T();
         }
 
+        /**
+         * Whether an object of type `T` may be moved to another address by copying its bytes and forgetting 
+         * the source, without running its move constructor and destructor. Trivially copyable types always can.
+         * Other types opt in by specializing this trait, e.g. `Unique` which only holds a pointer.
+         * @author ZhangKeyangZzz
+         * @tparam T The type of object.
+         */
+        template <typename T>
+        struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+        /**
+         * Whether two objects of type `T` are equal exactly when their bytes are, so ranges of them can be compared
+         * and searched with vector byte comparisons. Integers, enumerations and pointers are; floating point types
+         * are not, since `-0.0 == 0.0` and `NaN != NaN`. Types without padding whose `operator==` compares every
+         * member may opt in by specializing this trait.
+         * @author ZhangKeyangZzz
+         * @tparam T The type of object.
+         */
+        template <typename T>
+        struct is_trivially_comparable : std::integral_constant<bool,
+            std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value> {};
+
+        /// Returned by `find_of_range` when no element matches.
+        constexpr usize kNotFound = usize(-1);
+
+        ///-------------------------------------------------------------------------------------
+        ///
+        /// fill_of_range functions implementations.
+        ///
+        ///-------------------------------------------------------------------------------------
+        namespace __ignore {
+            /// This function is a part of implementation of memory utility function `fill_of_range`.
+            /// For trivially copyable data, assignment is a byte copy, so we can use the vector fill kernels.
+            template <typename T>
+            void __fill_of_range_unchecked(T *const arr, usize index, usize length, T const& value, std::true_type) noexcept {
+                __fill_trivial(arr + index, length, value);
+            }
+
+            /// This function is a part of implementation of memory utility function `fill_of_range`.
+            /// For non-trivially data, we need to call its `operator=` function to override these objects.
+            template <typename T>
+            void __fill_of_range_unchecked(T *const arr, usize index, usize length, T const& value, std::false_type) noexcept {
+                T* ptr = arr + index;
+                for (usize i = 0; i < length; i++) {
+                    ptr[i] = value;
+                }
+            }
+        }
+
         /**
          * Fill the initialized buffer `arr[index .. index + length)` with the specified value.
          * @author ZhangKeyangZzz
@@ -102,10 +335,12 @@ namespace glx {
          */
         template <typename T>
         int fill_of_range(T *const arr, usize index, usize length, T const& value) noexcept {
-            while (length > 0) {
-                arr[index + length - 1] = value;
-                length--;
+            if (arr == nullptr) {
+                return StatusCode::IllegalArgument;
             }
+            using IsTrivial = typename std::is_trivially_copyable<T>::type;
+            __ignore::__fill_of_range_unchecked(arr, index, length, value, IsTrivial());
+            return StatusCode::Success;
         }
 
         /**
@@ -131,18 +366,19 @@ namespace glx {
         ///-------------------------------------------------------------------------------------
         namespace __ignore {
             /// This function is a part of implementation of memory utility function `copy_of_range`.
-            /// For trivially data, the only thing we need to do is copying the memory bytes to bytes, 
+            /// For trivially copyable data, the only thing we need to do is copying the memory bytes to bytes,
+            /// streaming past the cache when the range is large or the caller asks for it.
             template <typename T>
-            void __copy_of_range_unchecked(T *const dst, const T* src, usize dstIndex, usize srcIndex, usize length, std::true_type) noexcept {
+            void __copy_of_range_unchecked(T *const dst, const T* src, usize dstIndex, usize srcIndex, usize length, CopyPolicy policy, std::true_type) noexcept {
                 auto totalBytes = length * sizeof(T);
-                memmove(dst, src, totalBytes);
+                __copy_trivial(dst + dstIndex, src + srcIndex, totalBytes, policy);
             }
 
             /// This function is a part of implementation of memory utility function `copy_of_range`.
             /// For non-trivially data, we need to call its `operator=` function to override these objects.
             /// NOTE: If dst[dstIndex] is not initialized, the behaviour of this function is UNDEFINED.
             template <typename T>
-            void __copy_of_range_unchecked(T *const dst, const T* src, usize dstIndex, usize srcIndex, usize length, std::false_type) noexcept {
+            void __copy_of_range_unchecked(T *const dst, const T* src, usize dstIndex, usize srcIndex, usize length, CopyPolicy, std::false_type) noexcept {
                 T* dstPtr = const_cast<T*>(dst + dstIndex);
                 T* srcPtr = const_cast<T*>(src + srcIndex);
                 if (dstPtr > srcPtr && dstPtr < srcPtr + length) {
@@ -177,8 +413,31 @@ namespace glx {
             if (dst == nullptr || src == nullptr || length == 0) {
                 return StatusCode::IllegalArgument;
             }
-            using IsTrivial = typename std::is_trivial<T>::type;
-            __ignore::__copy_of_range_unchecked(dst, src, dstIndex, srcIndex, length, IsTrivial());
+            using IsTrivial = typename std::is_trivially_copyable<T>::type;
+            __ignore::__copy_of_range_unchecked(dst, src, dstIndex, srcIndex, length, AutoCopy, IsTrivial());
+            return StatusCode::Success;
+        }
+
+        /**
+         * Copy specified count of objects from `src[srcIndex]` to `dst[dstIndex]`, choosing how trivially 
+         * copyable ranges use the cache. Non-trivially copyable types ignore the policy.
+         * @author ZhangKeyangZzz
+         * @param[in] dst The destination array.
+         * @param[in] src The source array.
+         * @param[in] srcIndex The offset of source position.
+         * @param[in] dstIndex The offset of destination position.
+         * @param[in] length The length of copy section.
+         * @param[in] policy `StreamingCopy` to bypass the cache, `CachedCopy` to keep the destination hot.
+         * @tparam T The type of elements in both array.
+         * @return Return the status code representing whether the operation was successful.
+         */
+        template <typename T>
+        int copy_of_range(T *const dst, const T* src, usize dstIndex, usize srcIndex, usize length, CopyPolicy policy) noexcept {
+            if (dst == nullptr || src == nullptr || length == 0) {
+                return StatusCode::IllegalArgument;
+            }
+            using IsTrivial = typename std::is_trivially_copyable<T>::type;
+            __ignore::__copy_of_range_unchecked(dst, src, dstIndex, srcIndex, length, policy, IsTrivial());
             return StatusCode::Success;
         }
 
@@ -197,8 +456,8 @@ namespace glx {
             if (arr == nullptr || length == 0) {
                 return StatusCode::IllegalArgument;
             }
-            using IsTrivial = typename std::is_trivial<T>::type;
-            __ignore::__copy_of_range_unchecked(arr, arr, dstIndex, srcIndex, length, IsTrivial());
+            using IsTrivial = typename std::is_trivially_copyable<T>::type;
+            __ignore::__copy_of_range_unchecked(arr, arr, dstIndex, srcIndex, length, AutoCopy, IsTrivial());
             return StatusCode::Success;
         }
 
@@ -209,18 +468,19 @@ namespace glx {
         ///-------------------------------------------------------------------------------------
         namespace __ignore {
             /// This function is a part of implementation of memory utility function `uninitialized_copy_of_range`.
-            /// For trivially data, the only thing we need to do is copying the memory bytes to bytes, 
+            /// For trivially copyable data, the only thing we need to do is copying the memory bytes to bytes,
+            /// streaming past the cache when the range is large or the caller asks for it.
             template <typename T>
-            void __uninitialized_copy_of_range_unchecked(T *const dst, const T* src, usize dstIndex, usize srcIndex, usize length, std::true_type) noexcept {
+            void __uninitialized_copy_of_range_unchecked(T *const dst, const T* src, usize dstIndex, usize srcIndex, usize length, CopyPolicy policy, std::true_type) noexcept {
                 auto totalBytes = length * sizeof(T);
-                memmove(dst, src, totalBytes);
+                __copy_trivial(dst + dstIndex, src + srcIndex, totalBytes, policy);
             }
 
             /// This function is a part of implementation of memory utility function `uninitialized_copy_of_range`.
             /// For non-trivially data, we need to call utility function `construct` to construct these objects.
             /// NOTE: If dst[dstIndex] is already initialized, the behaviour of this function is UNDEFINED.
             template <typename T>
-            void __uninitialized_copy_of_range_unchecked(T *const dst, const T* src, usize dstIndex, usize srcIndex, usize length, std::false_type) noexcept {
+            void __uninitialized_copy_of_range_unchecked(T *const dst, const T* src, usize dstIndex, usize srcIndex, usize length, CopyPolicy, std::false_type) noexcept {
                 T* dstPtr = const_cast<T*>(dst + dstIndex);
                 T* srcPtr = const_cast<T*>(src + srcIndex);
                 if (dstPtr > srcPtr && dstPtr < srcPtr + length) {
@@ -255,8 +515,31 @@ namespace glx {
             if (dst == nullptr || src == nullptr || length == 0) {
                 return StatusCode::IllegalArgument;
             }
-            using IsTrivial = typename std::is_trivial<T>::type;
-            __ignore::__uninitialized_copy_of_range_unchecked(dst, src, dstIndex, srcIndex, length, IsTrivial());
+            using IsTrivial = typename std::is_trivially_copyable<T>::type;
+            __ignore::__uninitialized_copy_of_range_unchecked(dst, src, dstIndex, srcIndex, length, AutoCopy, IsTrivial());
+            return StatusCode::Success;
+        }
+
+        /**
+         * Copy-construct specified count of objects from `src[srcIndex]` into the uninitialized `dst[dstIndex]`,
+         * choosing how trivially copyable ranges use the cache. Non-trivially copyable types ignore the policy.
+         * @author ZhangKeyangZzz
+         * @param[in] dst The destination array.
+         * @param[in] src The source array.
+         * @param[in] srcIndex The offset of source position.
+         * @param[in] dstIndex The offset of destination position.
+         * @param[in] length The length of copy section.
+         * @param[in] policy `StreamingCopy` to bypass the cache, `CachedCopy` to keep the destination hot.
+         * @tparam T The type of elements in both array.
+         * @return Return the status code representing whether the operation was successful.
+         */
+        template <typename T>
+        int uninitialized_copy_of_range(T *const dst, const T* src, usize dstIndex, usize srcIndex, usize length, CopyPolicy policy) noexcept {
+            if (dst == nullptr || src == nullptr || length == 0) {
+                return StatusCode::IllegalArgument;
+            }
+            using IsTrivial = typename std::is_trivially_copyable<T>::type;
+            __ignore::__uninitialized_copy_of_range_unchecked(dst, src, dstIndex, srcIndex, length, policy, IsTrivial());
             return StatusCode::Success;
         }
 
@@ -275,11 +558,318 @@ namespace glx {
             if (arr == nullptr || length == 0) {
                 return StatusCode::IllegalArgument;
             }
-            using IsTrivial = typename std::is_trivial<T>::type;
-            __ignore::__uninitialized_copy_of_range_unchecked(arr, arr, dstIndex, srcIndex, length, IsTrivial());
+            using IsTrivial = typename std::is_trivially_copyable<T>::type;
+            __ignore::__uninitialized_copy_of_range_unchecked(arr, arr, dstIndex, srcIndex, length, AutoCopy, IsTrivial());
             return StatusCode::Success;
         }
 
+        ///-------------------------------------------------------------------------------------
+        ///
+        /// move_of_range functions implementations.
+        ///
+        ///-------------------------------------------------------------------------------------
+        namespace __ignore {
+            /// This function is a part of implementation of memory utility function `move_of_range`.
+            /// For trivially copyable data, moving is copying the memory bytes to bytes.
+            template <typename T>
+            void __move_of_range_unchecked(T *const dst, T* src, usize dstIndex, usize srcIndex, usize length, std::true_type) noexcept {
+                auto totalBytes = length * sizeof(T);
+                memmove(dst + dstIndex, src + srcIndex, totalBytes);
+            }
+
+            /// This function is a part of implementation of memory utility function `move_of_range`.
+            /// For non-trivially data, we need to call its move `operator=` function to override these objects.
+            /// NOTE: If dst[dstIndex] is not initialized, the behaviour of this function is UNDEFINED.
+            template <typename T>
+            void __move_of_range_unchecked(T *const dst, T* src, usize dstIndex, usize srcIndex, usize length, std::false_type) noexcept {
+                T* dstPtr = dst + dstIndex;
+                T* srcPtr = src + srcIndex;
+                if (dstPtr > srcPtr && dstPtr < srcPtr + length) {
+                    while (length > 0) {
+                        dstPtr[length - 1] = std::move(srcPtr[length - 1]);
+                        length--;
+                    }
+                } else {
+                    while (length > 0) {
+                        *dstPtr = std::move(*srcPtr);
+                        dstPtr++;
+                        srcPtr++;
+                        length--;
+                    }
+                }
+            }
+        }
+
+        /**
+         * Move specified count of objects from `src[srcIndex]` to the initialized `dst[dstIndex]`.
+         * The source objects stay alive in their moved-from state.
+         * @author ZhangKeyangZzz
+         * @param[in] dst The destination array.
+         * @param[in] src The source array.
+         * @param[in] srcIndex The offset of source position.
+         * @param[in] dstIndex The offset of destination position.
+         * @param[in] length The length of move section.
+         * @tparam T The type of elements in both array.
+         * @return Return the status code representing whether the operation was successful.
+         */
+        template <typename T>
+        int move_of_range(T *const dst, T* src, usize dstIndex, usize srcIndex, usize length) noexcept {
+            if (dst == nullptr || src == nullptr || length == 0) {
+                return StatusCode::IllegalArgument;
+            }
+            using IsTrivial = typename std::is_trivially_copyable<T>::type;
+            __ignore::__move_of_range_unchecked(dst, src, dstIndex, srcIndex, length, IsTrivial());
+            return StatusCode::Success;
+        }
+
+        /**
+         * Move specified count of objects from `arr[srcIndex]` to `arr[dstIndex]`. Overlapping sections are allowed.
+         * @author ZhangKeyangZzz
+         * @param[in] arr A pointer to the array.
+         * @param[in] srcIndex The offset of source position.
+         * @param[in] dstIndex The offset of destination position.
+         * @param[in] length The length of move section.
+         * @tparam T The type of elements in the array.
+         * @return Return the status code representing whether the operation was successful.
+         */
+        template <typename T>
+        int move_of_range(T *const arr, usize dstIndex, usize srcIndex, usize length) noexcept {
+            if (arr == nullptr || length == 0) {
+                return StatusCode::IllegalArgument;
+            }
+            using IsTrivial = typename std::is_trivially_copyable<T>::type;
+            __ignore::__move_of_range_unchecked(arr, arr, dstIndex, srcIndex, length, IsTrivial());
+            return StatusCode::Success;
+        }
+
+        ///-------------------------------------------------------------------------------------
+        ///
+        /// uninitialized_move_of_range functions implementations.
+        ///
+        ///-------------------------------------------------------------------------------------
+        namespace __ignore {
+            /// This function is a part of implementation of memory utility function `uninitialized_move_of_range`.
+            /// For trivially copyable data, moving is copying the memory bytes to bytes.
+            template <typename T>
+            void __uninitialized_move_of_range_unchecked(T *const dst, T* src, usize dstIndex, usize srcIndex, usize length, std::true_type) noexcept {
+                auto totalBytes = length * sizeof(T);
+                memmove(dst + dstIndex, src + srcIndex, totalBytes);
+            }
+
+            /// This function is a part of implementation of memory utility function `uninitialized_move_of_range`.
+            /// For non-trivially data, we need to call utility function `construct` to move-construct these objects.
+            /// NOTE: If dst[dstIndex] is already initialized, the behaviour of this function is UNDEFINED.
+            template <typename T>
+            void __uninitialized_move_of_range_unchecked(T *const dst, T* src, usize dstIndex, usize srcIndex, usize length, std::false_type) noexcept {
+                T* dstPtr = dst + dstIndex;
+                T* srcPtr = src + srcIndex;
+                if (dstPtr > srcPtr && dstPtr < srcPtr + length) {
+                    while (length > 0) {
+                        construct(dstPtr + length - 1, std::move(srcPtr[length - 1]));
+                        length--;
+                    }
+                } else {
+                    while (length > 0) {
+                        construct(dstPtr, std::move(*srcPtr));
+                        dstPtr++;
+                        srcPtr++;
+                        length--;
+                    }
+                }
+            }
+        }
+
+        /**
+         * Move-construct specified count of objects from `src[srcIndex]` into the uninitialized `dst[dstIndex]`.
+         * The source objects stay alive in their moved-from state.
+         * @author ZhangKeyangZzz
+         * @param[in] dst The destination array.
+         * @param[in] src The source array.
+         * @param[in] srcIndex The offset of source position.
+         * @param[in] dstIndex The offset of destination position.
+         * @param[in] length The length of move section.
+         * @tparam T The type of elements in both array.
+         * @return Return the status code representing whether the operation was successful.
+         */
+        template <typename T>
+        int uninitialized_move_of_range(T *const dst, T* src, usize dstIndex, usize srcIndex, usize length) noexcept {
+            if (dst == nullptr || src == nullptr || length == 0) {
+                return StatusCode::IllegalArgument;
+            }
+            using IsTrivial = typename std::is_trivially_copyable<T>::type;
+            __ignore::__uninitialized_move_of_range_unchecked(dst, src, dstIndex, srcIndex, length, IsTrivial());
+            return StatusCode::Success;
+        }
+
+        /**
+         * Move-construct specified count of objects from `arr[srcIndex]` into the uninitialized `arr[dstIndex]`.
+         * @author ZhangKeyangZzz
+         * @param[in] arr A pointer to the array.
+         * @param[in] srcIndex The offset of source position.
+         * @param[in] dstIndex The offset of destination position.
+         * @param[in] length The length of move section.
+         * @tparam T The type of elements in the array.
+         * @return Return the status code representing whether the operation was successful.
+         */
+        template <typename T>
+        int uninitialized_move_of_range(T *const arr, usize dstIndex, usize srcIndex, usize length) noexcept {
+            if (arr == nullptr || length == 0) {
+                return StatusCode::IllegalArgument;
+            }
+            using IsTrivial = typename std::is_trivially_copyable<T>::type;
+            __ignore::__uninitialized_move_of_range_unchecked(arr, arr, dstIndex, srcIndex, length, IsTrivial());
+            return StatusCode::Success;
+        }
+
+        ///-------------------------------------------------------------------------------------
+        ///
+        /// relocate_of_range functions implementations.
+        ///
+        ///-------------------------------------------------------------------------------------
+        namespace __ignore {
+            /// This function is a part of implementation of memory utility function `relocate_of_range`.
+            /// For trivially relocatable data, the bytes are the object, so one `memmove` relocates the whole range.
+            template <typename T>
+            void __relocate_of_range_unchecked(T *const dst, T* src, usize dstIndex, usize srcIndex, usize length, std::true_type) noexcept {
+                auto totalBytes = length * sizeof(T);
+                memmove(static_cast<void*>(dst + dstIndex), static_cast<void const*>(src + srcIndex), totalBytes);
+            }
+
+            /// This function is a part of implementation of memory utility function `relocate_of_range`.
+            /// For other data, every object is move-constructed at its new place and destructed at the old one in one pass.
+            /// Walking in the direction of the move guarantees each destination slot is dead before it is written.
+            template <typename T>
+            void __relocate_of_range_unchecked(T *const dst, T* src, usize dstIndex, usize srcIndex, usize length, std::false_type) noexcept {
+                T* dstPtr = dst + dstIndex;
+                T* srcPtr = src + srcIndex;
+                if (dstPtr > srcPtr && dstPtr < srcPtr + length) {
+                    while (length > 0) {
+                        construct(dstPtr + length - 1, std::move(srcPtr[length - 1]));
+                        destruct(srcPtr + length - 1);
+                        length--;
+                    }
+                } else {
+                    while (length > 0) {
+                        construct(dstPtr, std::move(*srcPtr));
+                        destruct(srcPtr);
+                        dstPtr++;
+                        srcPtr++;
+                        length--;
+                    }
+                }
+            }
+        }
+
+        /**
+         * Relocate specified count of objects from `src[srcIndex]` to the uninitialized `dst[dstIndex]`.
+         * Afterwards `dst[dstIndex .. dstIndex + length)` is initialized and `src[srcIndex .. srcIndex + length)` 
+         * is uninitialized; no destructor must be run on the source again.
+         * @author ZhangKeyangZzz
+         * @param[in] dst The destination array.
+         * @param[in] src The source array.
+         * @param[in] srcIndex The offset of source position.
+         * @param[in] dstIndex The offset of destination position.
+         * @param[in] length The length of relocate section.
+         * @tparam T The type of elements in both array.
+         * @return Return the status code representing whether the operation was successful.
+         */
+        template <typename T>
+        int relocate_of_range(T *const dst, T* src, usize dstIndex, usize srcIndex, usize length) noexcept {
+            if (dst == nullptr || src == nullptr || length == 0) {
+                return StatusCode::IllegalArgument;
+            }
+            using IsRelocatable = typename is_trivially_relocatable<T>::type;
+            __ignore::__relocate_of_range_unchecked(dst, src, dstIndex, srcIndex, length, IsRelocatable());
+            return StatusCode::Success;
+        }
+
+        /**
+         * Relocate specified count of objects from `arr[srcIndex]` to `arr[dstIndex]`. Overlapping sections are allowed,
+         * which makes this the primitive to open or close a gap inside a buffer.
+         * @author ZhangKeyangZzz
+         * @param[in] arr A pointer to the array.
+         * @param[in] srcIndex The offset of source position.
+         * @param[in] dstIndex The offset of destination position.
+         * @param[in] length The length of relocate section.
+         * @tparam T The type of elements in the array.
+         * @return Return the status code representing whether the operation was successful.
+         */
+        template <typename T>
+        int relocate_of_range(T *const arr, usize dstIndex, usize srcIndex, usize length) noexcept {
+            if (arr == nullptr || length == 0) {
+                return StatusCode::IllegalArgument;
+            }
+            using IsRelocatable = typename is_trivially_relocatable<T>::type;
+            __ignore::__relocate_of_range_unchecked(arr, arr, dstIndex, srcIndex, length, IsRelocatable());
+            return StatusCode::Success;
+        }
+
+        ///-------------------------------------------------------------------------------------
+        ///
+        /// reallocate functions implementations.
+        ///
+        ///-------------------------------------------------------------------------------------
+        namespace __ignore {
+            /// This function is a part of implementation of memory utility function `reallocate`.
+            /// Trivially relocatable elements move with their bytes, so the allocator may grow the block in place,
+            /// remap it or copy it, whichever is cheapest.
+            template <typename T>
+            T* __reallocate_unchecked(T* ptr, usize oldCount, usize newCount, std::true_type) noexcept {
+                auto keep  = (oldCount < newCount ? oldCount : newCount) * sizeof(T);
+                auto block = __pool_reallocate(ptr, keep, newCount * sizeof(T), alignof(T));
+                return reinterpret_cast<T*>(block);
+            }
+
+            /// This function is a part of implementation of memory utility function `reallocate`.
+            /// Other elements stay where they are if the block is large enough, else they are moved to a new block.
+            template <typename T>
+            T* __reallocate_unchecked(T* ptr, usize oldCount, usize newCount, std::false_type) noexcept {
+                if (__resize_in_place(ptr, newCount * sizeof(T))) {
+                    return ptr;
+                }
+                auto block = allocate<T>(newCount);
+                if (block != nullptr) {
+                    __relocate_of_range_unchecked(block, ptr, 0, 0, oldCount < newCount ? oldCount : newCount, std::false_type());
+                    deallocate(ptr);
+                }
+                return block;
+            }
+        }
+
+        /**
+         * Resize a block returned by `allocate<T>` from `oldCount` to `newCount` elements. Elements past `newCount`
+         * are destructed, elements past `oldCount` are left uninitialized. A block stays where it is when its size
+         * class allows; trivially relocatable elements are otherwise moved by `mremap` or `realloc` for large blocks 
+         * and by one copy for small ones, other elements are move-constructed into a new block.
+         * @author ZhangKeyangZzz
+         * @param[in] ptr The block, or nullptr to allocate a new one.
+         * @param[in] oldCount The count of initialized elements in the block.
+         * @param[in] newCount The count of elements wanted; 0 destructs every element and frees the block.
+         * @tparam T The type of elements in the array.
+         * @return Returns the resized block, which may have moved. If the memory is exhausted, returns nullptr and 
+         *         the old block keeps its size and its first `min(oldCount, newCount)` elements.
+         * @note A sized `deallocate` of the resized block must pass the new size.
+         */
+        template <typename T>
+        inline T* reallocate(T* ptr, usize oldCount, usize newCount) noexcept {
+            if (ptr == nullptr) {
+                return allocate<T>(newCount);
+            }
+            if (newCount == 0) {
+                destruct_of_range(ptr, 0, oldCount);
+                deallocate(ptr);
+                return nullptr;
+            }
+            if (newCount > usize(-1) / sizeof(T)) {
+                return nullptr;
+            }
+            if (newCount < oldCount) {
+                destruct_of_range(ptr, newCount, oldCount - newCount);
+            }
+            using IsRelocatable = typename is_trivially_relocatable<T>::type;
+            return __ignore::__reallocate_unchecked(ptr, oldCount, newCount, IsRelocatable());
+        }
+
         ///-------------------------------------------------------------------------------------
         ///
         /// uninitialized_fill_of_range functions implementations.
@@ -287,14 +877,11 @@ namespace glx {
         ///-------------------------------------------------------------------------------------
         namespace __ignore {
             /// This function is a part of implementation of memory utility function `uninitialized_fill_of_range`.
-            /// For trivially data, the only thing we need to do is copying the memory bytes to bytes, 
+            /// For trivially copyable data, the only thing we need to do is copying the memory bytes to bytes,
+            /// which the vector fill kernels do at memory bandwidth.
             template <typename T>
             void __uninitialized_fill_of_range_unchecked(T *const arr, usize index, usize length, T const& value, std::true_type) noexcept {
-                auto elementSize = sizeof(T);
-                while (length > 0) {
-                    memmove(arr + index + length - 1, &value, elementSize);
-                    length--;
-                }
+                __fill_trivial(arr + index, length, value);
             }
 
             /// This function is a part of implementation of memory utility function `uninitialized_fill_of_range`.
@@ -324,11 +911,179 @@ namespace glx {
             if (arr == nullptr) {
                 return StatusCode::IllegalArgument;
             }
-            using IsTrivial = typename std::is_trivial<T>::type;
+            using IsTrivial = typename std::is_trivially_copyable<T>::type;
             __ignore::__uninitialized_fill_of_range_unchecked(arr, index, length, value, IsTrivial());
             return StatusCode::Success;
         }
 
+        ///-------------------------------------------------------------------------------------
+        ///
+        /// equal_of_range and compare_of_range functions implementations.
+        ///
+        ///-------------------------------------------------------------------------------------
+        namespace __ignore {
+            /// This function is a part of implementation of memory utility functions `equal_of_range` and `compare_of_range`.
+            /// For trivially comparable data, the first differing element holds the first differing byte, which the
+            /// vector comparison kernels find at load bandwidth.
+            template <typename T>
+            usize __mismatch_of_range_unchecked(const T* lhs, const T* rhs, usize length, std::true_type) noexcept {
+                return __mismatch_bytes(lhs, rhs, length * sizeof(T)) / sizeof(T);
+            }
+
+            /// This function is a part of implementation of memory utility functions `equal_of_range` and `compare_of_range`.
+            /// For other data, we need to call `operator==` element by element.
+            template <typename T>
+            usize __mismatch_of_range_unchecked(const T* lhs, const T* rhs, usize length, std::false_type) noexcept {
+                usize i = 0;
+                while (i < length && lhs[i] == rhs[i]) {
+                    i++;
+                }
+                return i;
+            }
+        }
+
+        /**
+         * Compare `lhs[lhsIndex .. lhsIndex + length)` with `rhs[rhsIndex .. rhsIndex + length)` element by element.
+         * @author ZhangKeyangZzz
+         * @param[in] lhs The first array.
+         * @param[in] rhs The second array.
+         * @param[in] lhsIndex The offset of the first section.
+         * @param[in] rhsIndex The offset of the second section.
+         * @param[in] length The length of both sections.
+         * @param[out] equal Receives whether every element of the sections is equal.
+         * @tparam T The type of elements in both array.
+         * @return Return the status code representing whether the operation was successful.
+         * @note Trivially comparable types (see `is_trivially_comparable`) are compared by vector kernels, other 
+         *       types with `operator==`.
+         */
+        template <typename T>
+        int equal_of_range(const T* lhs, const T* rhs, usize lhsIndex, usize rhsIndex, usize length, bool& equal) noexcept {
+            if (lhs == nullptr || rhs == nullptr) {
+                return StatusCode::IllegalArgument;
+            }
+            using IsTrivial = typename is_trivially_comparable<T>::type;
+            equal = __ignore::__mismatch_of_range_unchecked(lhs + lhsIndex, rhs + rhsIndex, length, IsTrivial()) == length;
+            return StatusCode::Success;
+        }
+
+        /**
+         * Compare `lhs[lhsIndex .. lhsIndex + length)` with `rhs[rhsIndex .. rhsIndex + length)` lexicographically.
+         * @author ZhangKeyangZzz
+         * @param[in] lhs The first array.
+         * @param[in] rhs The second array.
+         * @param[in] lhsIndex The offset of the first section.
+         * @param[in] rhsIndex The offset of the second section.
+         * @param[in] length The length of both sections.
+         * @param[out] order Receives -1, 0 or 1 as the first section orders before, equal to or after the second, 
+         *             decided by `operator<` on the first pair of elements that differ.
+         * @tparam T The type of elements in both array.
+         * @return Return the status code representing whether the operation was successful.
+         * @note Elements are ordered by value, not by bytes: a little-endian `uint32` is still compared as a number.
+         */
+        template <typename T>
+        int compare_of_range(const T* lhs, const T* rhs, usize lhsIndex, usize rhsIndex, usize length, int& order) noexcept {
+            if (lhs == nullptr || rhs == nullptr) {
+                return StatusCode::IllegalArgument;
+            }
+            using IsTrivial = typename is_trivially_comparable<T>::type;
+            auto lhsPtr = lhs + lhsIndex;
+            auto rhsPtr = rhs + rhsIndex;
+            auto at     = __ignore::__mismatch_of_range_unchecked(lhsPtr, rhsPtr, length, IsTrivial());
+            order = at == length ? 0 : lhsPtr[at] < rhsPtr[at] ? -1 : 1;
+            return StatusCode::Success;
+        }
+
+        ///-------------------------------------------------------------------------------------
+        ///
+        /// find_of_range and count_of_range functions implementations.
+        ///
+        ///-------------------------------------------------------------------------------------
+        namespace __ignore {
+            /// Trivially comparable elements of 1, 2, 4 or 8 bytes tile a vector register, the search kernels take them.
+            template <typename T>
+            using IsSearchable = std::integral_constant<bool, is_trivially_comparable<T>::value && 
+                (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)>;
+
+            /// This function is a part of implementation of memory utility function `find_of_range`.
+            template <typename T>
+            usize __find_of_range_unchecked(const T* ptr, usize length, T const& value, std::true_type) noexcept {
+                return __find_trivial<sizeof(T)>(ptr, length, &value);
+            }
+
+            /// This function is a part of implementation of memory utility function `find_of_range`.
+            /// For other data, we need to call `operator==` element by element.
+            template <typename T>
+            usize __find_of_range_unchecked(const T* ptr, usize length, T const& value, std::false_type) noexcept {
+                usize i = 0;
+                while (i < length && !(ptr[i] == value)) {
+                    i++;
+                }
+                return i;
+            }
+
+            /// This function is a part of implementation of memory utility function `count_of_range`.
+            template <typename T>
+            usize __count_of_range_unchecked(const T* ptr, usize length, T const& value, std::true_type) noexcept {
+                return __count_trivial<sizeof(T)>(ptr, length, &value);
+            }
+
+            /// This function is a part of implementation of memory utility function `count_of_range`.
+            /// For other data, we need to call `operator==` element by element.
+            template <typename T>
+            usize __count_of_range_unchecked(const T* ptr, usize length, T const& value, std::false_type) noexcept {
+                usize count = 0;
+                for (usize i = 0; i < length; i++) {
+                    if (ptr[i] == value) {
+                        count++;
+                    }
+                }
+                return count;
+            }
+        }
+
+        /**
+         * Find the first element equal to `value` in `arr[index .. index + length)`.
+         * @author ZhangKeyangZzz
+         * @param[in] arr The specified array.
+         * @param[in] index The specified index.
+         * @param[in] length The length of the section.
+         * @param[in] value The value looked for.
+         * @param[out] position Receives the index in `arr` of the first match, or `kNotFound`.
+         * @tparam T The type of elements in the array.
+         * @return Return the status code representing whether the operation was successful.
+         * @note Trivially comparable types of 1, 2, 4 or 8 bytes are searched by vector kernels, other types with
+         *       `operator==`.
+         */
+        template <typename T>
+        int find_of_range(const T* arr, usize index, usize length, T const& value, usize& position) noexcept {
+            if (arr == nullptr) {
+                return StatusCode::IllegalArgument;
+            }
+            auto at = __ignore::__find_of_range_unchecked(arr + index, length, value, __ignore::IsSearchable<T>());
+            position = at < length ? index + at : kNotFound;
+            return StatusCode::Success;
+        }
+
+        /**
+         * Count the elements equal to `value` in `arr[index .. index + length)`.
+         * @author ZhangKeyangZzz
+         * @param[in] arr The specified array.
+         * @param[in] index The specified index.
+         * @param[in] length The length of the section.
+         * @param[in] value The value counted.
+         * @param[out] count Receives the number of matches.
+         * @tparam T The type of elements in the array.
+         * @return Return the status code representing whether the operation was successful.
+         */
+        template <typename T>
+        int count_of_range(const T* arr, usize index, usize length, T const& value, usize& count) noexcept {
+            if (arr == nullptr) {
+                return StatusCode::IllegalArgument;
+            }
+            count = __ignore::__count_of_range_unchecked(arr + index, length, value, __ignore::IsSearchable<T>());
+            return StatusCode::Success;
+        }
+
         ///-------------------------------------------------------------------------------------
         ///
         /// Unique implementations.
@@ -345,6 +1100,72 @@ namespace glx {
                 void operator()(T const* ptr) { delete[] ptr; }
             };
 
+            /// Destroys `count` elements and returns their block to the pool with its size, see `make_unique_array`.
+            template <typename T>
+            struct PoolArrayDeleter {
+                usize count = 0;
+
+                PoolArrayDeleter() noexcept = default;
+                explicit PoolArrayDeleter(usize count) noexcept : count(count) {}
+
+                void operator()(T const* ptr) {
+                    auto elements = const_cast<T*>(ptr);
+                    for (usize i = 0; i < count; i++) {
+                        destruct(elements + i);
+                    }
+                    deallocate(elements, count * sizeof(T));
+                }
+            };
+
+            /// Select the deleter used by `Unique<T>` when none is given.
+            template <typename T>
+            struct DefaultDeleter {
+                using type = SimpleObjectDeleter<T>;
+            };
+
+            template <typename T>
+            struct DefaultDeleter<T[]> {
+                using type = SimpleArrayDeleter<T>;
+            };
+
+            ///
+            /// `CompressedPair` stores a deleter next to a pointer. An empty deleter becomes a base class, so
+            /// the empty-base optimization gives it no storage and the pair is as large as the pointer alone.
+            /// @author ZhangKeyangZzz
+            /// @tparam Dx The deleter type.
+            /// @tparam P The pointer type.
+            ///
+            template <typename Dx, typename P, bool = std::is_empty<Dx>::value && !std::is_final<Dx>::value>
+            class CompressedPair : private Dx {
+                P _second;
+
+            public:
+                template <typename D>
+                CompressedPair(D&& first, P second) noexcept : Dx(std::forward<D>(first)), _second(second) {}
+
+            public:
+                Dx& first() noexcept { return *this; }
+                Dx const& first() const noexcept { return *this; }
+                P& second() noexcept { return _second; }
+                P const& second() const noexcept { return _second; }
+            };
+
+            template <typename Dx, typename P>
+            class CompressedPair<Dx, P, false> {
+                Dx _first;
+                P  _second;
+
+            public:
+                template <typename D>
+                CompressedPair(D&& first, P second) noexcept : _first(std::forward<D>(first)), _second(second) {}
+
+            public:
+                Dx& first() noexcept { return _first; }
+                Dx const& first() const noexcept { return _first; }
+                P& second() noexcept { return _second; }
+                P const& second() const noexcept { return _second; }
+            };
+
             ///
             /// `UniqueBase` holds ownership of an object. Use the RAII feature to bind the life cycle of this object to `UniqueBase`
             /// @author ZhangKeyangZzz
@@ -355,8 +1176,7 @@ namespace glx {
             class UniqueBase {
                 using PtrType = std::remove_reference_t<T>;
                 using DelType = std::remove_reference_t<Dx>;
-                PtrType* _ptr;
-                DelType  _deleter;      /// This field is UNSTABLE. What happened when MOVE from anther UniqueBase? 
+                CompressedPair<DelType, PtrType*> _pair;    /// The deleter, then the pointer.
 
             private:
                 void _clear() noexcept;
@@ -385,28 +1205,28 @@ namespace glx {
             /// Delete internally held objects with the the deleter
             template <typename T, typename Dx>
             void UniqueBase<T, Dx>::_clear() noexcept {
-                if (_ptr != nullptr) {
-                    _deleter(_ptr);
-                    _ptr = nullptr;
+                auto& ptr = _pair.second();
+                if (ptr != nullptr) {
+                    _pair.first()(ptr);
+                    ptr = nullptr;
                 }
             }
 
             /// Construct from a user-ptr and a specified deleter.
             template <typename T, typename Dx>
-            UniqueBase<T, Dx>::UniqueBase(T* ptr, Dx deleter) noexcept : _ptr(ptr), _deleter(deleter) {
+            UniqueBase<T, Dx>::UniqueBase(T* ptr, Dx deleter) noexcept : _pair(std::forward<Dx>(deleter), ptr) {
             }
 
             /// Move from anther `UniqueBase`.
             template <typename T, typename Dx>
-            UniqueBase<T, Dx>::UniqueBase(UniqueBase<T, Dx>&& rhs) noexcept : _ptr(rhs._ptr), _deleter(std::forward<Dx>(rhs._deleter))  {
-                rhs._ptr = nullptr;
+            UniqueBase<T, Dx>::UniqueBase(UniqueBase<T, Dx>&& rhs) noexcept : _pair(std::forward<Dx>(rhs._pair.first()), rhs._pair.second())  {
+                rhs._pair.second() = nullptr;
             }
 
-            /// Destructor of `UniqueBase` ensuring destory the object.
+            /// Destructor of `UniqueBase` ensuring destory the object. The deleter is destroyed with the pair.
             template <typename T, typename Dx>
             UniqueBase<T, Dx>::~UniqueBase() noexcept {
                 _clear();
-                destruct(&_deleter);
             }
             
             /// Move from anther `UniqueBase`.
@@ -414,7 +1234,7 @@ namespace glx {
             UniqueBase<T, Dx>& UniqueBase<T, Dx>::operator=(UniqueBase<T, Dx>&& rhs) noexcept {
                 if (this != &rhs) {
                     reset(rhs.release());
-                    _deleter = std::forward<Dx>(rhs._deleter);
+                    _pair.first() = std::forward<Dx>(rhs._pair.first());
                 }
                 return *this;
             }
@@ -429,8 +1249,8 @@ namespace glx {
             /// Release the ownership of the object.
             template <typename T, typename Dx>
             T* UniqueBase<T, Dx>::release() noexcept {
-                auto ptr = _ptr;
-                _ptr = nullptr;
+                auto ptr = _pair.second();
+                _pair.second() = nullptr;
                 return ptr;
             }
 
@@ -438,7 +1258,7 @@ namespace glx {
             template <typename T, typename Dx>
             void UniqueBase<T, Dx>::reset(T* ptr) noexcept {
                 _clear();
-                _ptr = ptr;
+                _pair.second() = ptr;
             }
 
             /// swap between another UniqueBase.
@@ -461,7 +1281,7 @@ namespace glx {
             /// Get the raw ptr.
             template <typename T, typename Dx>
             const T* UniqueBase<T, Dx>::get() const noexcept {
-                return _ptr;
+                return _pair.second();
             }
 
             /// Get the underlying deleter.
@@ -475,7 +1295,7 @@ namespace glx {
             /// Get the underlying deleter.
             template <typename T, typename Dx>
             Dx const& UniqueBase<T, Dx>::get_deleter() const noexcept {
-                return _deleter;
+                return _pair.first();
             }
         }
         
@@ -485,22 +1305,24 @@ namespace glx {
          * This structure is a unique implementation of a single element.
          * @author ZhangKeyangZzz
          * @tparam T The type of object in this `Unique`
+         * @tparam Dx The deleter, `delete` by default.
          */
-        template <typename T>
-        struct Unique : public __ignore::UniqueBase<T, __ignore::SimpleObjectDeleter<T>> {
+        template <typename T, typename Dx = typename __ignore::DefaultDeleter<T>::type>
+        struct Unique : public __ignore::UniqueBase<T, Dx> {
         private:
-            using _Base = __ignore::UniqueBase<T, __ignore::SimpleObjectDeleter<T>>;
-            using _Del  = __ignore::SimpleObjectDeleter<T>;
+            using _Base = __ignore::UniqueBase<T, Dx>;
+            using _Del  = Dx;
         public:
             Unique() noexcept : _Base(nullptr, _Del()) {}
             Unique(T* ptr) noexcept : _Base(ptr, _Del()) {}
-            Unique(Unique<T> const&) = delete;
-            Unique(Unique<T>&& rhs) noexcept : _Base(std::move(rhs)) {}
+            Unique(T* ptr, Dx deleter) noexcept : _Base(ptr, deleter) {}
+            Unique(Unique<T, Dx> const&) = delete;
+            Unique(Unique<T, Dx>&& rhs) noexcept : _Base(std::move(rhs)) {}
             ~Unique() noexcept = default;
         public:
-            Unique<T>& operator=(Unique<T> const&) = delete;
-            Unique<T>& operator=(std::nullptr_t) { _Base::operator=(nullptr); return *this; };
-            Unique<T>& operator=(Unique<T>&& rhs) noexcept { _Base::operator=(std::move(rhs)); return *this; }
+            Unique<T, Dx>& operator=(Unique<T, Dx> const&) = delete;
+            Unique<T, Dx>& operator=(std::nullptr_t) { _Base::operator=(nullptr); return *this; };
+            Unique<T, Dx>& operator=(Unique<T, Dx>&& rhs) noexcept { _Base::operator=(std::move(rhs)); return *this; }
         public:
             T& operator*() noexcept { return *(_Base::get()); }
             T const& operator*() const noexcept { return *(_Base::get()); }
@@ -515,25 +1337,33 @@ namespace glx {
          * This structure is a unique implementation of continuous memory.
          * @author ZhangKeyangZzz
          * @tparam T The type of objects in this `Unique`
+         * @tparam Dx The deleter, `delete[]` by default.
          */
-        template <typename T>
-        class Unique<T[]> : public __ignore::UniqueBase<T, __ignore::SimpleArrayDeleter<T>> {
+        template <typename T, typename Dx>
+        class Unique<T[], Dx> : public __ignore::UniqueBase<T, Dx> {
         private:
-            using _Base = __ignore::UniqueBase<T, __ignore::SimpleArrayDeleter<T>>;
-            using _Del  = __ignore::SimpleArrayDeleter<T>;
+            using _Base = __ignore::UniqueBase<T, Dx>;
+            using _Del  = Dx;
         public:
             Unique() noexcept : _Base(nullptr, _Del()) {}
             Unique(T* ptr) noexcept : _Base(ptr, _Del()) {}
-            Unique(Unique<T[]> const&) = delete;
-            Unique(Unique<T[]>&& rhs) noexcept : _Base(std::move(rhs)) {}
+            Unique(T* ptr, Dx deleter) noexcept : _Base(ptr, deleter) {}
+            /// Take an array of `count` elements; only for deleters that track the count, like `UniqueArray`.
+            Unique(T* ptr, usize count) noexcept : _Base(ptr, _Del(count)) {}
+            Unique(Unique<T[], Dx> const&) = delete;
+            Unique(Unique<T[], Dx>&& rhs) noexcept : _Base(std::move(rhs)) {}
             ~Unique() noexcept = default;
         public:
-            Unique<T[]>& operator=(Unique<T[]> const&) = delete;
-            Unique<T[]>& operator=(std::nullptr_t) { _Base::operator=(nullptr); return *this; };
-            Unique<T[]>& operator=(Unique<T[]>&& rhs) noexcept { _Base::operator=(std::move(rhs)); return *this; }
+            Unique<T[], Dx>& operator=(Unique<T[], Dx> const&) = delete;
+            Unique<T[], Dx>& operator=(std::nullptr_t) { _Base::operator=(nullptr); return *this; };
+            Unique<T[], Dx>& operator=(Unique<T[], Dx>&& rhs) noexcept { _Base::operator=(std::move(rhs)); return *this; }
         public:
             T& operator*() noexcept { return *(_Base::get()); }
             T const& operator*() const noexcept { return *(_Base::get()); }
+            /// Replace the array with one of `count` elements; only for deleters that track the count.
+            void reset(T* ptr, usize count) noexcept { _Base::reset(ptr); _Base::get_deleter() = _Del(count); }
+            using _Base::reset;
+        public:
             T& operator[](usize index) noexcept { return *(_Base::get() + index); }
             T const& operator[](usize index) const noexcept { return *(_Base::get() + index); }
             T* operator->() noexcept { return _Base::get(); }
@@ -541,6 +1371,35 @@ namespace glx {
             operator bool() noexcept { return _Base::get() != nullptr; }
         };
 
+        /// `Unique` is a pointer plus its deleter, so it relocates by copying bytes whenever its deleter does.
+        template <typename T, typename Dx>
+        struct is_trivially_relocatable<Unique<T, Dx>> : is_trivially_relocatable<Dx> {};
+
+        /// A `Unique` owning an array from the pool that remembers its element count, see `make_unique_array`.
+        template <typename T>
+        using UniqueArray = Unique<T[], __ignore::PoolArrayDeleter<T>>;
+
+        /**
+         * Allocate `count` value-initialized elements from the pool. The element count travels with the deleter,
+         * so the array is freed with its size and never needs the block header.
+         * @author ZhangKeyangZzz
+         * @param[in] count The elements count.
+         * @tparam T The type of elements, aligned to no more than 16 bytes.
+         * @return Returns the array, or an empty `UniqueArray` if the memory is exhausted.
+         */
+        template <typename T>
+        inline UniqueArray<T> make_unique_array(usize count) noexcept {
+            static_assert(alignof(T) <= __ignore::kBlockHeaderBytes, "make_unique_array frees by size, which needs pool alignment.");
+            auto elements = allocate<T>(count);
+            if (elements == nullptr) {
+                return UniqueArray<T>();
+            }
+            for (usize i = 0; i < count; i++) {
+                construct(elements + i);
+            }
+            return UniqueArray<T>(elements, __ignore::PoolArrayDeleter<T>(count));
+        }
+
         /**
          * A convenient utility for `Unique`
          * @param[in] args arguments to construct a object of type `T`
@@ -552,6 +1411,52 @@ namespace glx {
             Unique<T> uniq(new T(std::forward<Args>(args)...));
             return Unique<T>(std::move(uniq));
         }
+
+        /**
+         * A deleter for objects allocated from the pool by `make_pool_unique`. It runs the destructor and returns
+         * the block to the pool directly, without going through `operator delete`.
+         * @tparam T The type of object.
+         * @note Exact types are freed by size. Polymorphic types may hold a derived object, so they are freed
+         *       through the block header instead.
+         */
+        template <typename T>
+        struct PoolDeleter {
+            void operator()(T const* ptr) {
+                auto object = const_cast<T*>(ptr);
+                destruct(object);
+                _free(object, std::integral_constant<bool, std::is_polymorphic<T>::value || (alignof(T) > __ignore::kBlockHeaderBytes)>());
+            }
+
+        private:
+            static void _free(T* object, std::true_type) { deallocate(object); }
+            static void _free(T* object, std::false_type) { deallocate(object, sizeof(T)); }
+        };
+
+        /// A `Unique` owning an object allocated from the pool.
+        template <typename T>
+        using PoolUnique = Unique<T, PoolDeleter<T>>;
+
+        /**
+         * Allocate an object from the pool and construct it in place.
+         * @author ZhangKeyangZzz
+         * @param[in] args arguments to construct a object of type `T`
+         * @tparam T The type of object.
+         * @tparam Args The argument types.
+         * @return Returns the object, or an empty `PoolUnique` if the memory is exhausted.
+         */
+        template <typename T, typename... Args>
+        inline PoolUnique<T> make_pool_unique(Args&&... args) noexcept {
+            auto object = allocate<T>(1);
+            if (object == nullptr) {
+                return PoolUnique<T>();
+            }
+            construct(object, std::forward<Args>(args)...);
+            return PoolUnique<T>(object);
+        }
+
+        static_assert(sizeof(Unique<int>) == sizeof(int*), "Unique with an empty deleter must be pointer-sized.");
+        static_assert(sizeof(Unique<int[]>) == sizeof(int*), "Unique with an empty deleter must be pointer-sized.");
+        static_assert(sizeof(PoolUnique<int>) == sizeof(int*), "PoolUnique must be pointer-sized.");
     }
 }
 
@@ -31,6 +31,7 @@
 #ifndef __GLX__CORE__OBJECT__HPP__
 #define __GLX__CORE__OBJECT__HPP__
 #include "mem_utilities.hpp"
+#include "mem_arena.hpp"
 
 namespace glx {
     struct Object {
@@ -40,12 +41,39 @@ namespace glx {
         static void* operator new[](size_t totalBytes) noexcept {
             return mem::allocate<byte>(totalBytes);
         }
-        static void operator delete(void* ptr) noexcept {
+        /// Place the object in `arena`. Such objects must not be `delete`d; own them with `mem::ArenaUnique`.
+        static void* operator new(size_t totalBytes, mem::Arena& arena) noexcept {
+            return arena.allocate_bytes(totalBytes);
+        }
+        /// Only the sized forms are declared, so `delete` passes the size and the pool skips the header lookup.
+        static void operator delete(void* ptr, size_t totalBytes) noexcept {
+            mem::deallocate(ptr, totalBytes);
+        }
+        static void operator delete[](void* ptr, size_t totalBytes) noexcept {
+            mem::deallocate(ptr, totalBytes);
+        }
+        static void operator delete(void*, mem::Arena&) noexcept {
+        }
+#if defined(__cpp_aligned_new)
+        static void* operator new(size_t totalBytes, std::align_val_t align) noexcept {
+            return mem::allocate_aligned<byte>(totalBytes, usize(align));
+        }
+        static void* operator new[](size_t totalBytes, std::align_val_t align) noexcept {
+            return mem::allocate_aligned<byte>(totalBytes, usize(align));
+        }
+        static void operator delete(void* ptr, std::align_val_t) noexcept {
             mem::deallocate(ptr);
         }
-        static void operator delete[](void* ptr) noexcept {
+        static void operator delete[](void* ptr, std::align_val_t) noexcept {
             mem::deallocate(ptr);
         }
+        /// Place an over-aligned object in `arena`; without this overload it would get the arena's default alignment.
+        static void* operator new(size_t totalBytes, std::align_val_t align, mem::Arena& arena) noexcept {
+            return arena.allocate_bytes(totalBytes, usize(align));
+        }
+        static void operator delete(void*, std::align_val_t, mem::Arena&) noexcept {
+        }
+#endif
         virtual ~Object() noexcept = default;
     };
 }
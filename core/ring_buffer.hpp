@@ -0,0 +1,315 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file provides the bounded rings `SpscRing` and `MpmcRing`, which pass runs of trivially copyable records
+ * between threads without a lock.
+ * 
+ * Both allocate their slots once, round the capacity up to a power of two and count positions with indices
+ * that only grow, so a slot is `index & mask` and the fill level is a subtraction. A batch is copied by 
+ * `mem::uninitialized_copy_of_range`, in two runs when it wraps around the end of the slots.
+ * 
+ * @file ring_buffer.hpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#ifndef __GLX__CORE__RING__BUFFER__HPP__
+#define __GLX__CORE__RING__BUFFER__HPP__
+#include "basic_types.hpp"
+#include "Uncopyable.hpp"
+#include "mem_utilities.hpp"
+#include <atomic>
+#include <thread>
+#include <type_traits>
+
+namespace glx {
+    namespace __ignore {
+        ///
+        /// `RingSlots` owns the slots of a ring and copies runs in and out of them.
+        /// @author ZhangKeyangZzz
+        /// @tparam T The type of records.
+        ///
+        template <typename T>
+        class RingSlots : public Uncopyable {
+            static_assert(std::is_trivially_copyable<T>::value, "Rings copy records by their bytes.");
+
+            T*    _slots    = nullptr;
+            usize _capacity = 0;
+
+        public:
+            /// Allocate a power of two of at least `capacity` slots. Without memory the ring has no slot at all,
+            /// so every push and pop moves nothing.
+            explicit RingSlots(usize capacity) noexcept {
+                usize rounded = 1;
+                while (rounded < capacity && rounded <= usize(-1) / 2 / sizeof(T)) {
+                    rounded *= 2;
+                }
+                if (rounded < capacity) {
+                    return;
+                }
+                _slots    = mem::allocate_cache_aligned<T>(rounded);
+                _capacity = _slots != nullptr ? rounded : 0;
+            }
+            ~RingSlots() noexcept { mem::deallocate(_slots); }
+
+        public:
+            usize capacity() const noexcept { return _capacity; }
+
+            void store(usize index, T const& value) noexcept { _slots[index & (_capacity - 1)] = value; }
+            T load(usize index) const noexcept { return _slots[index & (_capacity - 1)]; }
+
+            /// Copy `count` records from `src` to the slots from `index` on.
+            void copy_in(usize index, T const* src, usize count) noexcept {
+                auto offset = index & (_capacity - 1);
+                auto first  = count < _capacity - offset ? count : _capacity - offset;
+                mem::uninitialized_copy_of_range(_slots, src, offset, 0, first);
+                if (count > first) {
+                    mem::uninitialized_copy_of_range(_slots, src, 0, first, count - first);
+                }
+            }
+
+            /// Copy `count` records from the slots from `index` on to `dst`.
+            void copy_out(usize index, T* dst, usize count) const noexcept {
+                auto offset = index & (_capacity - 1);
+                auto first  = count < _capacity - offset ? count : _capacity - offset;
+                mem::uninitialized_copy_of_range(dst, _slots, 0, offset, first);
+                if (count > first) {
+                    mem::uninitialized_copy_of_range(dst, _slots, first, 0, count - first);
+                }
+            }
+        };
+    }
+
+    /**
+     * `SpscRing` is a bounded ring between exactly one producer thread and one consumer thread. The producer
+     * owns `_tail` and the consumer `_head`, each on its own cache line next to a cached copy of the other index:
+     * a side reloads the other index, and pulls its line over, only when the copy says the ring is full or empty.
+     * @author ZhangKeyangZzz
+     * @tparam T The type of records, which must be trivially copyable.
+     */
+    template <typename T>
+    class SpscRing : public Uncopyable {
+        alignas(mem::kCacheLineBytes) std::atomic<usize> _tail{0};
+        usize                                            _headCache = 0;    /// The producer's view of `_head`.
+        alignas(mem::kCacheLineBytes) std::atomic<usize> _head{0};
+        usize                                            _tailCache = 0;    /// The consumer's view of `_tail`.
+        alignas(mem::kCacheLineBytes) __ignore::RingSlots<T> _slots;
+
+    public:
+        /**
+         * Allocate the slots of a ring of at least `capacity` records.
+         * @param[in] capacity The wanted capacity, rounded up to a power of two.
+         * @note If the memory is exhausted `capacity()` returns 0 and the ring stays empty.
+         */
+        explicit SpscRing(usize capacity) noexcept : _slots(capacity) {}
+
+    public:
+        usize capacity() const noexcept { return _slots.capacity(); }
+
+        /// Return the count of records in the ring, exact only on the producer or consumer thread.
+        usize size() const noexcept {
+            auto head = _head.load(std::memory_order_acquire);
+            return _tail.load(std::memory_order_acquire) - head;
+        }
+
+        /**
+         * Push one record. Producer thread only.
+         * @param[in] value The record.
+         * @return Returns false if the ring is full.
+         */
+        bool try_push(T const& value) noexcept {
+            auto tail = _tail.load(std::memory_order_relaxed);
+            if (tail - _headCache == capacity()) {
+                _headCache = _head.load(std::memory_order_acquire);
+                if (tail - _headCache == capacity()) {
+                    return false;
+                }
+            }
+            _slots.store(tail, value);
+            _tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Pop one record. Consumer thread only.
+         * @param[out] value Receives the record.
+         * @return Returns false if the ring is empty.
+         */
+        bool try_pop(T& value) noexcept {
+            auto head = _head.load(std::memory_order_relaxed);
+            if (head == _tailCache) {
+                _tailCache = _tail.load(std::memory_order_acquire);
+                if (head == _tailCache) {
+                    return false;
+                }
+            }
+            value = _slots.load(head);
+            _head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Push up to `count` records from `src` as one run, published to the consumer at once. Producer thread only.
+         * @param[in] src The records.
+         * @param[in] count The count of records.
+         * @return Returns the count of records pushed, less than `count` if the ring filled up.
+         */
+        usize push_n(T const* src, usize count) noexcept {
+            auto tail = _tail.load(std::memory_order_relaxed);
+            if (capacity() - (tail - _headCache) < count) {
+                _headCache = _head.load(std::memory_order_acquire);
+            }
+            auto room = capacity() - (tail - _headCache);
+            count = count < room ? count : room;
+            if (count == 0) {
+                return 0;
+            }
+            _slots.copy_in(tail, src, count);
+            _tail.store(tail + count, std::memory_order_release);
+            return count;
+        }
+
+        /**
+         * Pop up to `count` records to `dst` as one run. Consumer thread only.
+         * @param[out] dst The buffer of at least `count` records.
+         * @param[in] count The count of records wanted.
+         * @return Returns the count of records popped, less than `count` if the ring ran empty.
+         */
+        usize pop_n(T* dst, usize count) noexcept {
+            auto head = _head.load(std::memory_order_relaxed);
+            if (_tailCache - head < count) {
+                _tailCache = _tail.load(std::memory_order_acquire);
+            }
+            auto ready = _tailCache - head;
+            count = count < ready ? count : ready;
+            if (count == 0) {
+                return 0;
+            }
+            _slots.copy_out(head, dst, count);
+            _head.store(head + count, std::memory_order_release);
+            return count;
+        }
+    };
+
+    /**
+     * `MpmcRing` is a bounded ring for any number of producer and consumer threads. Each side has a `head`,
+     * which threads advance by compare-and-swap to claim a run of slots, and a `tail`, which publishes runs to
+     * the other side in the order they were claimed. A thread claims its run, copies it with no lock held, then
+     * waits for the runs claimed before it to be published and publishes its own.
+     * @author ZhangKeyangZzz
+     * @tparam T The type of records, which must be trivially copyable.
+     * @note `head` is acquired and claimed with acquire-release: the thread that moved `head` last read the other
+     *       side's `tail` far enough to claim up to it, and acquiring `head` makes this thread read that `tail` or a
+     *       later one, so the room or the ready count it computes never wraps around.
+     * @note A thread preempted between claiming and publishing holds up publication on its side until it runs
+     *       again; claims and copies of the other threads go on meanwhile. Waiting threads yield.
+     */
+    template <typename T>
+    class MpmcRing : public Uncopyable {
+        struct alignas(mem::kCacheLineBytes) Side {
+            std::atomic<usize> head{0};     /// The end of the runs claimed.
+            std::atomic<usize> tail{0};     /// The end of the runs published.
+        };
+
+        Side                                                 _producer;
+        Side                                                 _consumer;
+        alignas(mem::kCacheLineBytes) __ignore::RingSlots<T> _slots;
+
+    public:
+        /**
+         * Allocate the slots of a ring of at least `capacity` records.
+         * @param[in] capacity The wanted capacity, rounded up to a power of two.
+         * @note If the memory is exhausted `capacity()` returns 0 and the ring stays empty.
+         */
+        explicit MpmcRing(usize capacity) noexcept : _slots(capacity) {}
+
+    public:
+        usize capacity() const noexcept { return _slots.capacity(); }
+
+        /// Return the count of records published and not yet claimed by a consumer, a snapshot only.
+        usize size() const noexcept {
+            auto head = _consumer.head.load(std::memory_order_acquire);
+            auto tail = _producer.tail.load(std::memory_order_acquire);
+            return tail > head ? tail - head : 0;
+        }
+
+        bool try_push(T const& value) noexcept { return push_n(&value, 1) == 1; }
+        bool try_pop(T& value) noexcept { return pop_n(&value, 1) == 1; }
+
+        /**
+         * Push up to `count` records from `src` as one run, which consumers see all at once.
+         * @param[in] src The records.
+         * @param[in] count The count of records.
+         * @return Returns the count of records pushed, less than `count` if the ring filled up.
+         */
+        usize push_n(T const* src, usize count) noexcept {
+            auto head = _producer.head.load(std::memory_order_acquire);
+            usize run;
+            do {
+                auto room = capacity() - (head - _consumer.tail.load(std::memory_order_acquire));
+                run = count < room ? count : room;
+                if (run == 0) {
+                    return 0;
+                }
+            } while (!_producer.head.compare_exchange_weak(head, head + run, std::memory_order_acq_rel, std::memory_order_acquire));
+            _slots.copy_in(head, src, run);
+            _publish(_producer.tail, head, run);
+            return run;
+        }
+
+        /**
+         * Pop up to `count` records to `dst` as one run.
+         * @param[out] dst The buffer of at least `count` records.
+         * @param[in] count The count of records wanted.
+         * @return Returns the count of records popped, less than `count` if the ring ran empty.
+         */
+        usize pop_n(T* dst, usize count) noexcept {
+            auto head = _consumer.head.load(std::memory_order_acquire);
+            usize run;
+            do {
+                auto ready = _producer.tail.load(std::memory_order_acquire) - head;
+                run = count < ready ? count : ready;
+                if (run == 0) {
+                    return 0;
+                }
+            } while (!_consumer.head.compare_exchange_weak(head, head + run, std::memory_order_acq_rel, std::memory_order_acquire));
+            _slots.copy_out(head, dst, run);
+            _publish(_consumer.tail, head, run);
+            return run;
+        }
+
+    private:
+        /// Publish the run `[from, from + count)` once every run claimed before it is published. Acquiring the
+        /// earlier release chains them, so a thread acquiring `tail` sees the copies of every run before it.
+        static void _publish(std::atomic<usize>& tail, usize from, usize count) noexcept {
+            while (tail.load(std::memory_order_acquire) != from) {
+                std::this_thread::yield();
+            }
+            tail.store(from + count, std::memory_order_release);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,196 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file provides `SmallVector`, a `Vector` holding its first elements inside the object, so short sequences
+ * never touch the heap.
+ * 
+ * @file small_vector.hpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#ifndef __GLX__CORE__SMALL__VECTOR__HPP__
+#define __GLX__CORE__SMALL__VECTOR__HPP__
+#include "vector.hpp"
+#include <atomic>
+#include <type_traits>
+
+namespace glx {
+    namespace __ignore {
+        /// Counts the heap blocks taken by every `SmallVector`, see `small_vector_heap_allocations`.
+        inline std::atomic<usize>& __small_vector_heap_allocations() noexcept {
+            static std::atomic<usize> count(0);
+            return count;
+        }
+    }
+
+    /**
+     * Return the count of heap blocks every `SmallVector` took so far, a spill out of the inline storage or a
+     * growth on the heap each counting one. Tests read it before and after a piece of code to assert that its
+     * vectors stayed inline.
+     * @author ZhangKeyangZzz
+     */
+    inline usize small_vector_heap_allocations() noexcept {
+        return __ignore::__small_vector_heap_allocations().load(std::memory_order_relaxed);
+    }
+
+    /**
+     * `SmallVector` is a `Vector` whose first `N` elements live in the object itself. Up to `N` elements it never
+     * calls `mem::allocate`; the first growth past them relocates the elements into a block from `mem::allocate`
+     * and later growth goes through `mem::reallocate`, exactly like `Vector`. `shrink_to_fit` brings elements
+     * that fit again back inline.
+     * @author ZhangKeyangZzz
+     * @tparam T The type of elements.
+     * @tparam N The count of inline elements, at least 1.
+     * @note Moving an inline vector relocates its elements, so it costs `N` elements at worst instead of a pointer
+     *       swap; a `SmallVector` is not trivially relocatable itself.
+     */
+    template <typename T, usize N>
+    class SmallVector : public __ignore::VectorBase<T, SmallVector<T, N>> {
+        static_assert(N > 0, "SmallVector needs room for one inline element, use Vector otherwise.");
+        using _Base = __ignore::VectorBase<T, SmallVector<T, N>>;
+        friend _Base;
+        using _Base::_data;
+        using _Base::_size;
+        using _Base::_capacity;
+
+        typename std::aligned_storage<sizeof(T) * N, alignof(T)>::type _storage;
+
+    public:
+        static constexpr usize kInlineCount = N;
+
+        /// The base gets the address of the storage only, taking it before the base exists is fine.
+        SmallVector() noexcept : _Base(reinterpret_cast<T*>(&_storage), N) {}
+        SmallVector(SmallVector<T, N> const&) = delete;
+        SmallVector(SmallVector<T, N>&& rhs) noexcept : _Base(reinterpret_cast<T*>(&_storage), N) { _take(rhs); }
+        ~SmallVector() noexcept { _release(); }
+
+    public:
+        SmallVector<T, N>& operator=(SmallVector<T, N> const&) = delete;
+        SmallVector<T, N>& operator=(SmallVector<T, N>&& rhs) noexcept {
+            if (this != &rhs) {
+                _release();
+                _take(rhs);
+            }
+            return *this;
+        }
+
+    public:
+        /// Whether the elements are in the inline storage.
+        bool is_inline() const noexcept { return _data == _inline(); }
+
+        /**
+         * Give the capacity past the size back. Elements that fit in the inline storage move back into it and
+         * the block is freed; otherwise the block is shrunk like that of a `Vector`.
+         * @author ZhangKeyangZzz
+         * @return Returns `Success`, or `OutOfMemory` if the elements had to move and no block was available.
+         */
+        int shrink_to_fit() noexcept {
+            if (is_inline()) {
+                return StatusCode::Success;
+            }
+            if (_size <= N) {
+                auto block = _data;
+                if (_size > 0) {
+                    mem::relocate_of_range(_inline(), block, 0, 0, _size);
+                }
+                _Base::_deallocate_block();
+                _data     = _inline();
+                _capacity = N;
+                return StatusCode::Success;
+            }
+            if (_Base::_fit(_size) == _capacity) {
+                return StatusCode::Success;
+            }
+            return _reallocate(_size);
+        }
+
+        /// Exchange the elements of two vectors, by three moves.
+        void swap(SmallVector<T, N>& rhs) noexcept {
+            SmallVector<T, N> tmp(std::move(rhs));
+            rhs   = std::move(*this);
+            *this = std::move(tmp);
+        }
+
+    private:
+        T* _inline() noexcept { return reinterpret_cast<T*>(&_storage); }
+        T const* _inline() const noexcept { return reinterpret_cast<T const*>(&_storage); }
+
+        /// Grow into a block of `count` elements. Leaving the inline storage relocates the elements once, since
+        /// there is no block for `mem::reallocate` to resize yet.
+        int _reallocate(usize count) noexcept {
+            if (!is_inline()) {
+                auto status = _Base::_reallocate_block(count);
+                if (status == StatusCode::Success) {
+                    __ignore::__small_vector_heap_allocations().fetch_add(1, std::memory_order_relaxed);
+                }
+                return status;
+            }
+            count = _Base::_fit(count);
+            auto block = mem::allocate<T>(count);
+            if (block == nullptr) {
+                return StatusCode::OutOfMemory;
+            }
+            __ignore::__small_vector_heap_allocations().fetch_add(1, std::memory_order_relaxed);
+            if (_size > 0) {
+                mem::relocate_of_range(block, _data, 0, 0, _size);
+            }
+            _data     = block;
+            _capacity = count;
+            return StatusCode::Success;
+        }
+
+        /// Take the elements of `rhs`, an inline vector by relocating them and a spilled one by its block, and
+        /// leave `rhs` empty and inline. The elements of this vector must already be released.
+        void _take(SmallVector<T, N>& rhs) noexcept {
+            if (rhs.is_inline()) {
+                if (rhs._size > 0) {
+                    mem::relocate_of_range(_inline(), rhs._data, 0, 0, rhs._size);
+                }
+                _data     = _inline();
+                _capacity = N;
+            } else {
+                _data     = rhs._data;
+                _capacity = rhs._capacity;
+            }
+            _size         = rhs._size;
+            rhs._data     = rhs._inline();
+            rhs._size     = 0;
+            rhs._capacity = N;
+        }
+
+        /// Destruct every element and free the block, if any.
+        void _release() noexcept {
+            _Base::_truncate(0);
+            if (!is_inline()) {
+                _Base::_deallocate_block();
+                _data     = _inline();
+                _capacity = N;
+            }
+        }
+    };
+}
+
+#endif
@@ -46,6 +46,8 @@ namespace glx {
         IllegalArgument  = 1, /// At least one argument is invaild.
         IllegalState     = 2, /// Some data is in illegal state.
         IndexOutOfRange  = 3, /// Index out of range. 
+        IOError          = 4, /// Reading or writing a file failed.
+        OutOfMemory      = 5, /// The system or a memory budget has no room for the request.
     };
 }
 
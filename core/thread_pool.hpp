@@ -0,0 +1,291 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file provides `ThreadPool`, a reusable pool of workers with work-stealing queues.
+ * 
+ * @file thread_pool.hpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#ifndef __GLX__CORE__THREAD__POOL__HPP__
+#define __GLX__CORE__THREAD__POOL__HPP__
+#include "basic_types.hpp"
+#include "Uncopyable.hpp"
+#include "mem_utilities.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace glx {
+    /**
+     * `ThreadPool` runs data-parallel loops on a fixed set of workers.
+     * Every worker owns a queue: it pops its own tasks from the back and, once idle, steals from the
+     * front of the other queues, so uneven chunks still keep every core busy. The thread calling
+     * `parallel_for` helps until its loop is finished, which also makes nested loops safe.
+     * @author ZhangKeyangZzz
+     */
+    class ThreadPool : public Uncopyable {
+        struct Job {
+            void (*invoke)(void* body, usize chunk);
+            void*              body;
+            std::atomic<usize> pending;
+        };
+
+        struct Task {
+            Job*  job;
+            usize chunk;
+        };
+
+        struct alignas(mem::kCacheLineBytes) Queue {
+            std::mutex       lock;
+            std::deque<Task> tasks;
+            std::deque<Task> pinned;    /// Calls of `for_each_thread`, which only the owner of the queue may run.
+        };
+
+        std::vector<std::thread> _workers;
+        Queue*                   _queues;
+        usize                    _queueCount;
+        std::mutex               _sleepLock;
+        std::condition_variable  _wakeup;
+        uint64                   _epoch = 0;
+        bool                     _stopping = false;
+
+    public:
+        /**
+         * Start `workers` threads. A pool with no workers runs every loop on the calling thread.
+         * @param[in] workers The count of worker threads.
+         * @note If the queues can't be allocated, the pool starts no workers.
+         */
+        explicit ThreadPool(usize workers) noexcept : _queueCount(workers > 0 ? workers : 1) {
+            _queues = mem::allocate<Queue>(_queueCount);
+            if (_queues == nullptr) {
+                _queueCount = 0;
+                return;
+            }
+            for (usize i = 0; i < _queueCount; i++) {
+                mem::construct(_queues + i);
+            }
+            for (usize i = 0; i < workers; i++) {
+                _workers.emplace_back([this, i] { _work(i); });
+            }
+        }
+
+        ~ThreadPool() noexcept {
+            {
+                std::lock_guard<std::mutex> guard(_sleepLock);
+                _stopping = true;
+            }
+            _wakeup.notify_all();
+            for (auto& worker : _workers) {
+                worker.join();
+            }
+            mem::destruct_of_range(_queues, 0, _queueCount);
+            mem::deallocate(_queues);
+        }
+
+    public:
+        /// Return the count of threads taking part in a loop, the caller included.
+        usize concurrency() const noexcept {
+            return _workers.size() + 1;
+        }
+
+        /**
+         * Call `body(chunk)` for every chunk in `[0, chunks)` across the pool and return once all calls are done.
+         * @param[in] chunks The count of chunks.
+         * @param[in] body A callable taking the chunk index. Calls for different chunks may run concurrently.
+         */
+        template <typename F>
+        void parallel_for(usize chunks, F&& body) noexcept {
+            using Body = std::remove_reference_t<F>;
+            if (chunks == 0) {
+                return;
+            }
+            if (chunks == 1 || _workers.empty()) {
+                for (usize chunk = 0; chunk < chunks; chunk++) {
+                    body(chunk);
+                }
+                return;
+            }
+            Job job;
+            job.invoke  = [](void* ptr, usize chunk) { (*reinterpret_cast<Body*>(ptr))(chunk); };
+            job.body    = const_cast<void*>(reinterpret_cast<void const*>(&body));
+            job.pending.store(chunks, std::memory_order_relaxed);
+            for (usize i = 0; i < _queueCount; i++) {
+                std::lock_guard<std::mutex> guard(_queues[i].lock);
+                for (auto chunk = i; chunk < chunks; chunk += _queueCount) {
+                    _queues[i].tasks.push_back(Task{ &job, chunk });
+                }
+            }
+            {
+                std::lock_guard<std::mutex> guard(_sleepLock);
+                _epoch++;
+            }
+            _wakeup.notify_all();
+            _help(job);
+        }
+
+        /**
+         * Call `body(thread)` once on every thread of the loop, `thread` in `[0, concurrency())`: worker `i` always
+         * runs `i` and the caller runs the last. Unlike `parallel_for` nothing is stolen, so memory a thread first
+         * touches here is placed on that thread's NUMA node, and later calls with the same index find it there.
+         * @param[in] body A callable taking the thread index.
+         * @note Called from a task of this pool, the calls run one after another on the calling thread, since
+         *       the calling worker couldn't run its own call while waiting.
+         */
+        template <typename F>
+        void for_each_thread(F&& body) noexcept {
+            using Body = std::remove_reference_t<F>;
+            if (_workers.empty() || _tls_pool() == this) {
+                for (usize thread = 0; thread < concurrency(); thread++) {
+                    body(thread);
+                }
+                return;
+            }
+            Job job;
+            job.invoke  = [](void* ptr, usize chunk) { (*reinterpret_cast<Body*>(ptr))(chunk); };
+            job.body    = const_cast<void*>(reinterpret_cast<void const*>(&body));
+            job.pending.store(_workers.size(), std::memory_order_relaxed);
+            for (usize i = 0; i < _workers.size(); i++) {
+                std::lock_guard<std::mutex> guard(_queues[i].lock);
+                _queues[i].pinned.push_back(Task{ &job, i });
+            }
+            {
+                std::lock_guard<std::mutex> guard(_sleepLock);
+                _epoch++;
+            }
+            _wakeup.notify_all();
+            body(_workers.size());
+            _help(job);
+        }
+
+        /**
+         * Return the process-wide pool with one worker per additional hardware thread.
+         * The environment variable `GLX_THREADS` overrides the total thread count.
+         */
+        static ThreadPool& global() noexcept {
+            static ThreadPool pool(_default_workers());
+            return pool;
+        }
+
+    private:
+        static usize _default_workers() noexcept {
+            auto threads = usize(std::thread::hardware_concurrency());
+            if (auto env = std::getenv("GLX_THREADS")) {
+                threads = usize(std::strtoul(env, nullptr, 10));
+            }
+            return threads > 1 ? threads - 1 : 0;
+        }
+
+        /// The pool whose worker the calling thread is, nullptr for any other thread.
+        static ThreadPool*& _tls_pool() noexcept {
+            thread_local ThreadPool* pool = nullptr;
+            return pool;
+        }
+
+        /// The index of the calling worker in the pool `_tls_pool()`.
+        static usize& _tls_index() noexcept {
+            thread_local usize index = 0;
+            return index;
+        }
+
+        static void _run(Task const& task) noexcept {
+            task.job->invoke(task.job->body, task.chunk);
+            task.job->pending.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
+        /// Take a task of the owner's queue: a pinned one first, else the newest.
+        bool _pop(usize index, Task& task) noexcept {
+            auto& queue = _queues[index];
+            std::lock_guard<std::mutex> guard(queue.lock);
+            if (!queue.pinned.empty()) {
+                task = queue.pinned.front();
+                queue.pinned.pop_front();
+                return true;
+            }
+            if (queue.tasks.empty()) {
+                return false;
+            }
+            task = queue.tasks.back();
+            queue.tasks.pop_back();
+            return true;
+        }
+
+        /// Take the oldest task of the first non-empty queue, starting at `start`. Pinned tasks are never stolen.
+        bool _steal(usize start, Task& task) noexcept {
+            for (usize i = 0; i < _queueCount; i++) {
+                auto& queue = _queues[(start + i) % _queueCount];
+                std::lock_guard<std::mutex> guard(queue.lock);
+                if (!queue.tasks.empty()) {
+                    task = queue.tasks.front();
+                    queue.tasks.pop_front();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /// Run tasks until `job` is finished. A worker waiting inside a task of this pool runs its own queue first,
+        /// so its pinned tasks and the chunks it queued for a nested loop make progress while it waits.
+        void _help(Job& job) noexcept {
+            auto  worker = _tls_pool() == this;
+            usize victim = worker ? _tls_index() + 1 : 0;
+            while (job.pending.load(std::memory_order_acquire) != 0) {
+                Task task;
+                if ((worker && _pop(_tls_index(), task)) || _steal(victim, task)) {
+                    _run(task);
+                } else {
+                    std::this_thread::yield();
+                }
+                victim++;
+            }
+        }
+
+        void _work(usize index) noexcept {
+            _tls_pool()  = this;
+            _tls_index() = index;
+            uint64 seen = 0;
+            while (true) {
+                Task task;
+                if (_pop(index, task) || _steal(index + 1, task)) {
+                    _run(task);
+                    continue;
+                }
+                std::unique_lock<std::mutex> guard(_sleepLock);
+                _wakeup.wait(guard, [&] { return _stopping || _epoch != seen; });
+                if (_stopping) {
+                    return;
+                }
+                seen = _epoch;
+            }
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,497 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file provides `Vector`, a growable array built on the `mem` primitives. Trivially relocatable elements
+ * move by `memcpy` or stay in place when the array grows, and fallible operations return a `StatusCode`.
+ * 
+ * @file vector.hpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#ifndef __GLX__CORE__VECTOR__HPP__
+#define __GLX__CORE__VECTOR__HPP__
+#include "basic_types.hpp"
+#include "status_code.hpp"
+#include "mem_utilities.hpp"
+#include <functional>
+#include <utility>
+
+namespace glx {
+    namespace __ignore {
+        ///
+        /// `VectorBase` holds the elements of `Vector` and `SmallVector` and every operation on them. Where a block
+        /// comes from is up to `Derived`, whose `_reallocate(count)` gives the vector room for `count` elements
+        /// and whose destructor frees the block; blocks from `mem::allocate` are handled by `_reallocate_block`
+        /// and `_deallocate_block`.
+        /// @author ZhangKeyangZzz
+        /// @tparam T The type of elements.
+        /// @tparam Derived The vector type built on this base.
+        ///
+        template <typename T, typename Derived>
+        class VectorBase {
+        protected:
+            T*    _data     = nullptr;
+            usize _size     = 0;
+            usize _capacity = 0;
+
+        public:
+            static constexpr usize kMaxCount    = usize(-1) / sizeof(T);
+            static constexpr usize kMinCapacity = sizeof(T) < 64 ? 64 / sizeof(T) : 1;  /// The first block holds 64 bytes.
+
+        protected:
+            VectorBase() noexcept = default;
+            VectorBase(T* data, usize capacity) noexcept : _data(data), _capacity(capacity) {}
+            VectorBase(VectorBase<T, Derived> const&) = delete;
+            ~VectorBase() noexcept = default;
+            VectorBase<T, Derived>& operator=(VectorBase<T, Derived> const&) = delete;
+
+        public:
+            T* data() noexcept { return _data; }
+            T const* data() const noexcept { return _data; }
+            usize size() const noexcept { return _size; }
+            usize capacity() const noexcept { return _capacity; }
+            bool empty() const noexcept { return _size == 0; }
+
+            T& operator[](usize index) noexcept { return _data[index]; }
+            T const& operator[](usize index) const noexcept { return _data[index]; }
+            T& front() noexcept { return _data[0]; }
+            T const& front() const noexcept { return _data[0]; }
+            T& back() noexcept { return _data[_size - 1]; }
+            T const& back() const noexcept { return _data[_size - 1]; }
+
+            T* begin() noexcept { return _data; }
+            T const* begin() const noexcept { return _data; }
+            T* end() noexcept { return _data + _size; }
+            T const* end() const noexcept { return _data + _size; }
+
+        public:
+            /**
+             * Make room for at least `count` elements without growing again.
+             * @author ZhangKeyangZzz
+             * @param[in] count The wanted capacity.
+             * @return Returns `Success`, `IllegalArgument` if `count` exceeds `kMaxCount`, or `OutOfMemory`.
+             */
+            int reserve(usize count) noexcept {
+                if (count <= _capacity) {
+                    return StatusCode::Success;
+                }
+                if (count > kMaxCount) {
+                    return StatusCode::IllegalArgument;
+                }
+                return _derived()._reallocate(count);
+            }
+
+            /**
+             * Construct an element at the end from `args`.
+             * @author ZhangKeyangZzz
+             * @param[in] args The arguments of the constructor of `T`, which may refer to elements of this vector.
+             * @tparam Args The argument types.
+             * @return Returns `Success`, `IllegalArgument` if the vector is full at `kMaxCount`, or `OutOfMemory`.
+             */
+            template <typename... Args>
+            int emplace_back(Args&&... args) noexcept {
+                if (_size == _capacity) {
+                    return _emplace_back_slow(std::forward<Args>(args)...);
+                }
+                mem::construct(_data + _size, std::forward<Args>(args)...);
+                _size++;
+                return StatusCode::Success;
+            }
+
+            int push_back(T const& value) noexcept { return emplace_back(value); }
+            int push_back(T&& value) noexcept { return emplace_back(std::move(value)); }
+
+            /// Destruct the last element. The vector must not be empty.
+            void pop_back() noexcept {
+                _size--;
+                mem::destruct(_data + _size);
+            }
+
+            /**
+             * Copy `length` elements from `src` to the end. The room is reserved once and the elements are built by
+             * a single `mem::uninitialized_copy_of_range`, which copies trivially copyable data with vector stores.
+             * @author ZhangKeyangZzz
+             * @param[in] src The elements to copy, which may be elements of this vector.
+             * @param[in] length The count of elements.
+             * @return Returns `Success`, `IllegalArgument` if `src` is nullptr or the size would exceed `kMaxCount`,
+             *         or `OutOfMemory`.
+             */
+            int append_range(T const* src, usize length) noexcept {
+                if (length == 0) {
+                    return StatusCode::Success;
+                }
+                if (src == nullptr) {
+                    return StatusCode::IllegalArgument;
+                }
+                if (length > _capacity - _size) {
+                    auto inside = _contains(src);
+                    auto offset = inside ? usize(src - _data) : 0;
+                    auto status = _grow(length);
+                    if (status != StatusCode::Success) {
+                        return status;
+                    }
+                    src = inside ? _data + offset : src;
+                }
+                mem::uninitialized_copy_of_range(_data, src, _size, 0, length);
+                _size += length;
+                return StatusCode::Success;
+            }
+
+            /**
+             * Construct an element at `index` from `args`, moving the elements from `index` on up by one.
+             * @author ZhangKeyangZzz
+             * @param[in] index The position of the new element, at most `size()`.
+             * @param[in] args The arguments of the constructor of `T`, which may refer to elements of this vector.
+             * @tparam Args The argument types.
+             * @return Returns `Success`, `IndexOutOfRange` if `index` is past the end, `IllegalArgument` if the
+             *         vector is full at `kMaxCount`, or `OutOfMemory`.
+             */
+            template <typename... Args>
+            int emplace(usize index, Args&&... args) noexcept {
+                if (index > _size) {
+                    return StatusCode::IndexOutOfRange;
+                }
+                if (index == _size) {
+                    return emplace_back(std::forward<Args>(args)...);
+                }
+                T value(std::forward<Args>(args)...);
+                if (_size == _capacity) {
+                    auto status = _grow(1);
+                    if (status != StatusCode::Success) {
+                        return status;
+                    }
+                }
+                mem::relocate_of_range(_data, index + 1, index, _size - index);
+                mem::construct(_data + index, std::move(value));
+                _size++;
+                return StatusCode::Success;
+            }
+
+            int insert(usize index, T const& value) noexcept { return emplace(index, value); }
+            int insert(usize index, T&& value) noexcept { return emplace(index, std::move(value)); }
+
+            /**
+             * Copy `length` elements from `src` to `index`, moving the elements from `index` on up by `length`.
+             * @author ZhangKeyangZzz
+             * @param[in] index The position of the first new element, at most `size()`.
+             * @param[in] src The elements to copy.
+             * @param[in] length The count of elements.
+             * @return Returns `Success`, `IndexOutOfRange` if `index` is past the end, `IllegalArgument` if `src` is
+             *         nullptr or lies in this vector or the size would exceed `kMaxCount`, or `OutOfMemory`.
+             */
+            int insert_range(usize index, T const* src, usize length) noexcept {
+                if (index > _size) {
+                    return StatusCode::IndexOutOfRange;
+                }
+                if (length == 0) {
+                    return StatusCode::Success;
+                }
+                if (src == nullptr || _overlaps(src, length)) {
+                    return StatusCode::IllegalArgument;
+                }
+                if (length > _capacity - _size) {
+                    auto status = _grow(length);
+                    if (status != StatusCode::Success) {
+                        return status;
+                    }
+                }
+                if (index < _size) {
+                    mem::relocate_of_range(_data, index + length, index, _size - index);
+                }
+                mem::uninitialized_copy_of_range(_data, src, index, 0, length);
+                _size += length;
+                return StatusCode::Success;
+            }
+
+            /**
+             * Destruct the element at `index` and move the elements after it down by one.
+             * @author ZhangKeyangZzz
+             * @param[in] index The position of the element.
+             * @return Returns `Success`, or `IndexOutOfRange` if there is no element at `index`.
+             */
+            int erase(usize index) noexcept {
+                return erase_range(index, 1);
+            }
+
+            /**
+             * Destruct `length` elements from `index` and move the elements after them down by `length`.
+             * @author ZhangKeyangZzz
+             * @param[in] index The position of the first element.
+             * @param[in] length The count of elements.
+             * @return Returns `Success`, or `IndexOutOfRange` if the range runs past the end.
+             */
+            int erase_range(usize index, usize length) noexcept {
+                if (index > _size || length > _size - index) {
+                    return StatusCode::IndexOutOfRange;
+                }
+                if (length == 0) {
+                    return StatusCode::Success;
+                }
+                mem::destruct_of_range(_data, index, length);
+                if (index + length < _size) {
+                    mem::relocate_of_range(_data, index, index + length, _size - index - length);
+                }
+                _size -= length;
+                return StatusCode::Success;
+            }
+
+            /**
+             * Destruct the elements past `count`, or value-initialize elements up to `count`.
+             * @author ZhangKeyangZzz
+             * @param[in] count The new size.
+             * @return Returns `Success`, `IllegalArgument` if `count` exceeds `kMaxCount`, or `OutOfMemory`.
+             */
+            int resize(usize count) noexcept {
+                if (count <= _size) {
+                    _truncate(count);
+                    return StatusCode::Success;
+                }
+                auto status = _reserve_for(count);
+                if (status != StatusCode::Success) {
+                    return status;
+                }
+                for (; _size < count; _size++) {
+                    mem::construct(_data + _size);
+                }
+                return StatusCode::Success;
+            }
+
+            /**
+             * Destruct the elements past `count`, or fill copies of `value` up to `count`.
+             * @author ZhangKeyangZzz
+             * @param[in] count The new size.
+             * @param[in] value The value of new elements, which must not be an element of this vector.
+             * @return Returns `Success`, `IllegalArgument` if `count` exceeds `kMaxCount`, or `OutOfMemory`.
+             */
+            int resize(usize count, T const& value) noexcept {
+                if (count <= _size) {
+                    _truncate(count);
+                    return StatusCode::Success;
+                }
+                auto status = _reserve_for(count);
+                if (status != StatusCode::Success) {
+                    return status;
+                }
+                mem::uninitialized_fill_of_range(_data, _size, count - _size, value);
+                _size = count;
+                return StatusCode::Success;
+            }
+
+            /// Destruct every element. The capacity is kept.
+            void clear() noexcept {
+                _truncate(0);
+            }
+
+        protected:
+            Derived& _derived() noexcept { return static_cast<Derived&>(*this); }
+
+            /// The capacity of a block for `count` elements: a small block is rounded up to its size class, whose
+            /// whole bytes map back to the same class, so a sized `deallocate` of the capacity stays correct.
+            static usize _fit(usize count) noexcept {
+                auto bytes = count * sizeof(T);
+                if (alignof(T) > mem::__ignore::kBlockHeaderBytes || bytes == 0 || bytes > mem::__ignore::kMaxSmallBytes) {
+                    return count;
+                }
+                return mem::__ignore::__class_to_size(mem::__ignore::__size_to_class(bytes)) / sizeof(T);
+            }
+
+            /// Whether `ptr` points to an element of this vector. Pointers of unrelated objects are ordered by `std::less`.
+            bool _contains(T const* ptr) const noexcept {
+                return !std::less<T const*>()(ptr, _data) && std::less<T const*>()(ptr, _data + _size);
+            }
+
+            /// Whether `[ptr, ptr + length)` shares an address with the block of this vector.
+            bool _overlaps(T const* ptr, usize length) const noexcept {
+                return _data != nullptr && std::less<T const*>()(ptr, _data + _capacity) && std::less<T const*>()(_data, ptr + length);
+            }
+
+            /// Move the elements of a block from `mem::allocate` to a block of `count` elements, or resize the block
+            /// where it is. Both start from nullptr.
+            int _reallocate_block(usize count) noexcept {
+                count = _fit(count);
+                auto block = mem::reallocate(_data, _size, count);
+                if (block == nullptr) {
+                    return StatusCode::OutOfMemory;
+                }
+                _data     = block;
+                _capacity = count;
+                return StatusCode::Success;
+            }
+
+            /// Free a block from `mem::allocate`, whose elements are already destructed. Blocks of over-aligned
+            /// types must be freed by address.
+            void _deallocate_block() noexcept {
+                if (alignof(T) > mem::__ignore::kBlockHeaderBytes) {
+                    mem::deallocate(_data);
+                } else {
+                    mem::deallocate(_data, _capacity * sizeof(T));
+                }
+            }
+
+            /// Make room for `extra` more elements than the size, growing by at least half of the capacity.
+            int _grow(usize extra) noexcept {
+                if (extra > kMaxCount - _size) {
+                    return StatusCode::IllegalArgument;
+                }
+                auto wanted = _capacity + _capacity / 2;
+                if (wanted < _capacity || wanted > kMaxCount) {
+                    wanted = kMaxCount;
+                }
+                if (wanted < _size + extra) {
+                    wanted = _size + extra;
+                }
+                return _derived()._reallocate(wanted < kMinCapacity ? kMinCapacity : wanted);
+            }
+
+            /// Make room for `count` elements, growing geometrically like a run of `push_back` would.
+            int _reserve_for(usize count) noexcept {
+                if (count > kMaxCount) {
+                    return StatusCode::IllegalArgument;
+                }
+                return count <= _capacity ? int(StatusCode::Success) : _grow(count - _size);
+            }
+
+            /// Kept out of line, so `emplace_back` inlines to a compare, a construct and an increment. The element is
+            /// built first, because `args` may refer to the elements the growth is about to move.
+            template <typename... Args>
+            GLX_COLD int _emplace_back_slow(Args&&... args) noexcept {
+                T value(std::forward<Args>(args)...);
+                auto status = _grow(1);
+                if (status != StatusCode::Success) {
+                    return status;
+                }
+                mem::construct(_data + _size, std::move(value));
+                _size++;
+                return StatusCode::Success;
+            }
+
+            void _truncate(usize count) noexcept {
+                if (count < _size) {
+                    mem::destruct_of_range(_data, count, _size - count);
+                    _size = count;
+                }
+            }
+        };
+    }
+
+    /**
+     * `Vector` is a contiguous array that grows by half of its capacity when full. Growth goes through
+     * `mem::reallocate`: trivially relocatable elements (see `mem::is_trivially_relocatable`) keep their block
+     * when the allocator can resize it, and are otherwise moved with their bytes, without a move constructor or
+     * destructor call per element. A small block is rounded up to its whole size class, so the slack of the
+     * class is usable capacity.
+     *
+     * Operations that allocate never throw. They return `Success`, `IllegalArgument` for a count that can't be
+     * addressed, `IndexOutOfRange` for a position past the end, or `OutOfMemory`; the vector is left as it was
+     * on failure. Element constructors are expected not to throw, as everywhere in `mem`.
+     * @author ZhangKeyangZzz
+     * @tparam T The type of elements.
+     * @note Copying a vector is not supported, move it or `append_range` its elements instead.
+     */
+    template <typename T>
+    class Vector : public __ignore::VectorBase<T, Vector<T>> {
+        using _Base = __ignore::VectorBase<T, Vector<T>>;
+        friend _Base;
+        using _Base::_data;
+        using _Base::_size;
+        using _Base::_capacity;
+
+    public:
+        Vector() noexcept = default;
+        Vector(Vector<T> const&) = delete;
+        Vector(Vector<T>&& rhs) noexcept : _Base(rhs._data, rhs._capacity) {
+            _size         = rhs._size;
+            rhs._data     = nullptr;
+            rhs._size     = 0;
+            rhs._capacity = 0;
+        }
+        ~Vector() noexcept { _release(); }
+
+    public:
+        Vector<T>& operator=(Vector<T> const&) = delete;
+        Vector<T>& operator=(Vector<T>&& rhs) noexcept {
+            if (this != &rhs) {
+                _release();
+                _data         = rhs._data;
+                _size         = rhs._size;
+                _capacity     = rhs._capacity;
+                rhs._data     = nullptr;
+                rhs._size     = 0;
+                rhs._capacity = 0;
+            }
+            return *this;
+        }
+
+    public:
+        /**
+         * Give the capacity past the size back to the allocator. The block is shrunk where it is when the
+         * allocator allows, an empty vector frees it.
+         * @author ZhangKeyangZzz
+         * @return Returns `Success`, or `OutOfMemory` if the elements had to move and no block was available.
+         */
+        int shrink_to_fit() noexcept {
+            if (_size == 0) {
+                _release();
+                return StatusCode::Success;
+            }
+            if (_Base::_fit(_size) == _capacity) {
+                return StatusCode::Success;
+            }
+            return _reallocate(_size);
+        }
+
+        /// Exchange the elements and blocks of two vectors.
+        void swap(Vector<T>& rhs) noexcept {
+            std::swap(_data, rhs._data);
+            std::swap(_size, rhs._size);
+            std::swap(_capacity, rhs._capacity);
+        }
+
+    private:
+        int _reallocate(usize count) noexcept {
+            return _Base::_reallocate_block(count);
+        }
+
+        /// Destruct every element and free the block.
+        void _release() noexcept {
+            if (_data == nullptr) {
+                return;
+            }
+            _Base::_truncate(0);
+            _Base::_deallocate_block();
+            _data     = nullptr;
+            _capacity = 0;
+        }
+    };
+
+    namespace mem {
+        /// `Vector` is a pointer and two counts, so it relocates by copying its bytes.
+        template <typename T>
+        struct is_trivially_relocatable<Vector<T>> : std::true_type {};
+    }
+}
+
+#endif
@@ -0,0 +1,242 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Checks of `ByteChain`: random edits against a `std::string` model, and round trips through a non-blocking
+ * pipe and a local file with `write_to` and `read_from`, covering short reads and writes, `EAGAIN`, the end of
+ * the file and chains of more than `kMaxIovecs` views.
+ * 
+ * @file byte_chain_test.cpp
+ * @date 2026-10-17
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "test_support.hpp"
+#include "../core/byte_chain.hpp"
+#include <cerrno>
+#include <cstdlib>
+#include <string>
+#if defined(__linux__)
+#include <fcntl.h>
+#endif
+
+namespace {
+    using namespace glx;
+
+    std::string contents_of(ByteChain const& chain) {
+        std::string bytes(chain.size(), '\0');
+        if (!bytes.empty()) {
+            chain.copy_out(0, &bytes[0], bytes.size());
+        }
+        return bytes;
+    }
+
+    std::string pattern_of(usize bytes, uint32& seed) {
+        std::string text(bytes, '\0');
+        for (auto& c : text) {
+            seed = seed * 1664525u + 1013904223u;
+            c    = char(seed >> 24);
+        }
+        return text;
+    }
+
+    /// A chain of `bytes` bytes made of views of at most `piece` bytes each.
+    ByteChain fragmented(std::string const& text, usize piece) {
+        ByteChain whole;
+        whole.append(text.data(), text.size());
+        ByteChain result;
+        for (usize offset = 0; offset < text.size(); offset += piece) {
+            ByteChain part;
+            whole.slice(offset, piece < text.size() - offset ? piece : text.size() - offset, part);
+            result.append(std::move(part));
+        }
+        return result;
+    }
+
+    void check_model() {
+        uint32      seed = 12345;
+        ByteChain   chain;
+        std::string model;
+        auto        same = true;
+        for (usize step = 0; step < 20000 && same; step++) {
+            seed = seed * 1664525u + 1013904223u;
+            auto bytes = usize(seed >> 8) % 9000;
+            auto at    = model.empty() ? 0 : usize(seed >> 4) % (model.size() + 1);
+            switch ((seed >> 28) % 8) {
+            case 0: {
+                auto text = pattern_of(bytes, seed);
+                GLX_CHECK(chain.append(text.data(), text.size()) == StatusCode::Success);
+                model += text;
+                break;
+            }
+            case 1: {
+                auto text = pattern_of(bytes % 300, seed);
+                GLX_CHECK(chain.prepend(text.data(), text.size()) == StatusCode::Success);
+                model.insert(0, text);
+                break;
+            }
+            case 2: {
+                ByteChain front;
+                GLX_CHECK(chain.split_front(at, front) == StatusCode::Success);
+                GLX_CHECK(contents_of(front) == model.substr(0, at));
+                chain.append(std::move(front));
+                model = model.substr(at) + model.substr(0, at);
+                break;
+            }
+            case 3: {
+                ByteChain part;
+                auto length = (model.size() - at) / 2;
+                GLX_CHECK(chain.slice(at, length, part) == StatusCode::Success);
+                GLX_CHECK(contents_of(part) == model.substr(at, length));
+                chain.prepend(std::move(part));
+                model = model.substr(at, length) + model;
+                break;
+            }
+            case 4:
+                GLX_CHECK(chain.consume(at / 2) == StatusCode::Success);
+                model.erase(0, at / 2);
+                break;
+            case 5:
+                GLX_CHECK(chain.trim_back(at / 3) == StatusCode::Success);
+                model.erase(model.size() - at / 3);
+                break;
+            case 6:
+                GLX_CHECK(chain.coalesce(at) == StatusCode::Success);
+                GLX_CHECK(chain.front_length() >= at);
+                break;
+            default:
+                if (model.size() > 100000) {
+                    chain.clear();
+                    model.clear();
+                }
+                break;
+            }
+            same = GLX_CHECK(chain.size() == model.size() && contents_of(chain) == model);
+        }
+        GLX_CHECK(chain.coalesce() == StatusCode::Success);
+        GLX_CHECK(chain.segment_count() <= 1);
+        GLX_CHECK(std::string(reinterpret_cast<char const*>(chain.data()), chain.front_length()) == model);
+    }
+
+#if defined(__linux__)
+    void check_iovecs() {
+        uint32 seed  = 7;
+        auto   text  = pattern_of(1000, seed);
+        auto   chain = fragmented(text, 100);
+        iovec  vectors[4];
+        GLX_CHECK(chain.export_iovecs(vectors, 4, 3) == 4);
+        GLX_CHECK(vectors[0].iov_len == 100 && std::memcmp(vectors[0].iov_base, text.data() + 300, 100) == 0);
+        GLX_CHECK(chain.export_iovecs(vectors, 4, 8) == 2);
+        GLX_CHECK(chain.export_iovecs(vectors, 4, 10) == 0);
+    }
+
+    /// Push a chain of many small views through a non-blocking pipe, whose 64 KB buffer makes writes short and
+    /// both ends hit `EAGAIN`, then read the end of the file.
+    void check_pipe() {
+        int fds[2];
+        if (!GLX_CHECK(::pipe2(fds, O_NONBLOCK) == 0)) {
+            return;
+        }
+        uint32 seed = 99;
+        auto   text = pattern_of(1 << 20, seed);
+        auto   out  = fragmented(text, 777);
+        GLX_CHECK(out.segment_count() > ByteChain::kMaxIovecs);
+        ByteChain in;
+        usize     bytes;
+        GLX_CHECK(in.read_from(fds[0], 4096, bytes) == StatusCode::IOError && errno == EAGAIN && bytes == 0);
+        auto sawFull  = false;
+        auto sawShort = false;
+        while (!out.empty()) {
+            // Fill the pipe, then drain it.
+            while (!out.empty()) {
+                iovec vectors[ByteChain::kMaxIovecs];
+                usize offered = 0;
+                auto  count   = out.export_iovecs(vectors, ByteChain::kMaxIovecs);
+                for (usize i = 0; i < count; i++) {
+                    offered += vectors[i].iov_len;
+                }
+                auto size = out.size();
+                if (out.write_to(fds[1], bytes) != StatusCode::Success) {
+                    GLX_CHECK(errno == EAGAIN && out.size() == size);
+                    sawFull = true;
+                    break;
+                }
+                GLX_CHECK(bytes > 0 && bytes <= offered && out.size() == size - bytes);
+                sawShort = sawShort || bytes < offered;
+            }
+            // Read in odd sizes, so reads end inside blocks and the next one fills their room first.
+            while (in.read_from(fds[0], 10000 + in.size() % 5000, bytes) == StatusCode::Success && bytes > 0) {
+            }
+        }
+        GLX_CHECK(sawFull && sawShort);
+        ::close(fds[1]);
+        while (in.read_from(fds[0], 1 << 20, bytes) == StatusCode::Success && bytes > 0) {
+        }
+        GLX_CHECK(in.read_from(fds[0], 1 << 20, bytes) == StatusCode::Success && bytes == 0);
+        GLX_CHECK(contents_of(in) == text);
+        ::close(fds[0]);
+    }
+
+    /// Write a chain to a local file and read it back in several sizes; the last read is short, then one reads 0.
+    void check_file() {
+        char path[] = "/tmp/byte_chain_test.XXXXXX";
+        auto fd     = ::mkstemp(path);
+        if (!GLX_CHECK(fd >= 0)) {
+            return;
+        }
+        ::unlink(path);
+        uint32 seed = 5;
+        auto   text = pattern_of(300000 + 123, seed);
+        auto   out  = fragmented(text, 1000);
+        usize  bytes;
+        while (!out.empty()) {
+            GLX_CHECK(out.write_to(fd, bytes) == StatusCode::Success && bytes > 0);
+        }
+        GLX_CHECK(::lseek(fd, 0, SEEK_SET) == 0);
+        ByteChain in;
+        for (usize want : { usize(1), usize(4095), usize(5000), usize(ByteChain::kBlockBytes * ByteChain::kMaxIovecs * 2) }) {
+            GLX_CHECK(in.read_from(fd, want, bytes) == StatusCode::Success);
+            GLX_CHECK(bytes <= want && bytes > 0);
+        }
+        while (in.read_from(fd, 100000, bytes) == StatusCode::Success && bytes > 0) {
+        }
+        GLX_CHECK(bytes == 0);
+        GLX_CHECK(contents_of(in) == text);
+        ::close(fd);
+        ByteChain closed;
+        GLX_CHECK(closed.read_from(fd, 100, bytes) == StatusCode::IOError && errno == EBADF);
+        GLX_CHECK(closed.empty());
+    }
+#endif
+}
+
+int main() {
+    check_model();
+#if defined(__linux__)
+    check_iovecs();
+    check_pipe();
+    check_file();
+#endif
+    return test::result();
+}
@@ -0,0 +1,132 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Checks of `mem::fill_of_range` and `mem::uninitialized_fill_of_range` against `std::fill` for 1 to 16 byte
+ * element types, every length up to a few thousand and every head alignment within a cache line. CTest runs it
+ * once per `GLX_SIMD` level, so each kernel is checked on hosts that have it.
+ * 
+ * @file fill_test.cpp
+ * @date 2026-10-17
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "test_support.hpp"
+#include "../core/mem_utilities.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    using namespace glx;
+
+    /// An element of `N` bytes aligned to one byte, so a range of them may start at any address.
+    template <usize N>
+    struct Bytes {
+        byte raw[N];
+
+        bool operator==(Bytes const& rhs) const noexcept { return std::memcmp(raw, rhs.raw, N) == 0; }
+    };
+
+    template <usize N>
+    Bytes<N> bytes_of(byte seed) {
+        Bytes<N> value;
+        for (usize i = 0; i < N; i++) {
+            value.raw[i] = byte(seed + i * 37);
+        }
+        return value;
+    }
+
+    constexpr usize kGuardBytes = 64;
+    constexpr usize kMaxLength  = 3000;
+
+    /// Fill `length` elements at byte offset `head` of a guarded buffer, and compare every byte with `std::fill`.
+    template <typename T>
+    void check_fill(T const& value, T const& previous, usize head, usize length, bool initialized) {
+        alignas(64) static byte actual[kGuardBytes * 2 + kMaxLength * 16];
+        alignas(64) static byte expected[sizeof(actual)];
+        auto total = kGuardBytes * 2 + length * sizeof(T);
+        std::memset(actual, 0xcd, total);
+        for (usize i = 0; i < length; i++) {
+            std::memcpy(actual + kGuardBytes + head + i * sizeof(T), &previous, sizeof(T));
+        }
+        std::memcpy(expected, actual, total);
+        auto dst = reinterpret_cast<T*>(actual + kGuardBytes + head);
+        auto ref = reinterpret_cast<T*>(expected + kGuardBytes + head);
+        std::fill(ref, ref + length, value);
+        if (initialized) {
+            GLX_CHECK(mem::fill_of_range(dst, 0, length, value) == StatusCode::Success);
+        } else {
+            GLX_CHECK(mem::uninitialized_fill_of_range(dst, 0, length, value) == StatusCode::Success);
+        }
+        if (!GLX_CHECK(std::memcmp(actual, expected, total) == 0)) {
+            std::fprintf(stderr, "  element %zu bytes, head %zu, length %zu\n", sizeof(T), head, length);
+        }
+    }
+
+    /// Lengths 0 to 300 one by one, then in strides that land on and around every vector width.
+    template <typename T>
+    void check_lengths(T const& value, T const& previous, usize head, bool initialized) {
+        for (usize length = 0; length <= kMaxLength; length += length < 300 ? 1 : 61) {
+            check_fill(value, previous, head, length, initialized);
+        }
+    }
+
+    template <usize N>
+    void check_bytes() {
+        auto value    = bytes_of<N>(1);
+        auto pattern  = bytes_of<N>(0);
+        auto previous = bytes_of<N>(200);
+        std::memset(pattern.raw, 0x7f, N);
+        for (usize head = 0; head < 64; head++) {
+            check_lengths(value, previous, head, true);
+            check_lengths(value, previous, head, false);
+        }
+        // A byte pattern takes the memset path.
+        check_lengths(pattern, previous, 3, true);
+    }
+
+    /// Naturally aligned types, misaligned by whole elements only.
+    template <typename T>
+    void check_aligned(T const& value, T const& previous) {
+        for (usize head = 0; head < 64; head += sizeof(T)) {
+            check_lengths(value, previous, head, true);
+        }
+    }
+}
+
+int main() {
+    std::printf("simd level %d\n", int(cpu::simd_level()));
+    check_bytes<1>();
+    check_bytes<2>();
+    check_bytes<4>();
+    check_bytes<8>();
+    check_bytes<16>();
+    check_bytes<3>();
+    check_aligned<uint16>(0x1234, 7);
+    check_aligned<uint32>(0x12345678u, 7);
+    check_aligned<float>(1.5f, -0.0f);
+    check_aligned<uint64>(0x0123456789abcdefull, 7);
+    check_aligned<double>(-2.25, 0.0);
+    return test::result();
+}
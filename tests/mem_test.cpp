@@ -0,0 +1,157 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Checks of the `mem::` primitives against the matching `std::` algorithms, on a trivial and a non-trivial
+ * element type, over disjoint and overlapping ranges.
+ * 
+ * @file mem_test.cpp
+ * @date 2026-10-17
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "test_support.hpp"
+#include "../core/mem_utilities.hpp"
+#include "../core/object.hpp"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+    using namespace glx;
+
+    std::string text_of(usize i) {
+        return std::string("element #") + std::to_string(i) + std::string(i % 7, 'x');
+    }
+
+    template <typename T>
+    T value_of(usize i);
+
+    template <>
+    uint64 value_of<uint64>(usize i) {
+        return uint64(i) * 0x9e3779b97f4a7c15ull;
+    }
+
+    template <>
+    std::string value_of<std::string>(usize i) {
+        return text_of(i);
+    }
+
+    template <typename T>
+    void check_copies(usize length) {
+        std::vector<T> model(length * 2);
+        for (usize i = 0; i < model.size(); i++) {
+            model[i] = value_of<T>(i);
+        }
+        auto src = mem::allocate<T>(length * 2);
+        auto dst = mem::allocate<T>(length * 2);
+        GLX_CHECK(src != nullptr && dst != nullptr);
+        for (usize i = 0; i < length * 2; i++) {
+            mem::construct(src + i, model[i]);
+        }
+        GLX_CHECK(mem::uninitialized_copy_of_range(dst, src, 0, 0, length * 2) == StatusCode::Success);
+        GLX_CHECK(std::equal(dst, dst + length * 2, model.begin()));
+
+        // Disjoint, then overlapping in both directions.
+        GLX_CHECK(mem::fill_of_range(dst, 0, length, value_of<T>(1)) == StatusCode::Success);
+        GLX_CHECK(std::count(dst, dst + length, value_of<T>(1)) == std::ptrdiff_t(length));
+        GLX_CHECK(mem::copy_of_range(dst, src, 0, length, length) == StatusCode::Success);
+        GLX_CHECK(std::equal(dst, dst + length, model.begin() + std::ptrdiff_t(length)));
+        auto shift = length / 3 + 1;
+        std::copy_backward(model.begin(), model.begin() + std::ptrdiff_t(length), model.begin() + std::ptrdiff_t(length + shift));
+        GLX_CHECK(mem::copy_of_range(src, shift, 0, length) == StatusCode::Success);
+        GLX_CHECK(std::equal(src, src + length * 2, model.begin()));
+        std::copy(model.begin() + std::ptrdiff_t(shift), model.begin() + std::ptrdiff_t(shift + length), model.begin());
+        GLX_CHECK(mem::move_of_range(src, 0, shift, length) == StatusCode::Success);
+        GLX_CHECK(std::equal(src, src + length, model.begin()));
+
+        // Relocating leaves the source uninitialized, so only the destination is destructed afterwards.
+        mem::destruct_of_range(dst, 0, length * 2);
+        GLX_CHECK(mem::relocate_of_range(dst, src, 0, 0, length * 2) == StatusCode::Success);
+        GLX_CHECK(std::equal(dst, dst + length, model.begin()));
+        mem::destruct_of_range(dst, 0, length * 2);
+        mem::deallocate(dst);
+        mem::deallocate(src);
+    }
+
+    void check_reallocate() {
+        auto arr = mem::allocate<std::string>(3);
+        for (usize i = 0; i < 3; i++) {
+            mem::construct(arr + i, text_of(i));
+        }
+        arr = mem::reallocate(arr, 3, 1000);
+        GLX_CHECK(arr != nullptr);
+        for (usize i = 3; i < 1000; i++) {
+            mem::construct(arr + i, text_of(i));
+        }
+        arr = mem::reallocate(arr, 1000, 10);
+        GLX_CHECK(arr != nullptr);
+        for (usize i = 0; i < 10; i++) {
+            GLX_CHECK(arr[i] == text_of(i));
+        }
+        GLX_CHECK(mem::reallocate(arr, 10, 0) == nullptr);
+    }
+
+    struct Node : Object {
+        uint64 value;
+        explicit Node(uint64 value) noexcept : value(value) {}
+    };
+
+    struct alignas(64) WideNode : Object {
+        uint64 value;
+        explicit WideNode(uint64 value) noexcept : value(value) {}
+    };
+
+    void check_unique() {
+        auto one = mem::make_unique<std::string>("unique");
+        GLX_CHECK(one && *one == "unique");
+        auto many = mem::make_unique_array<uint64>(100);
+        GLX_CHECK(many && many[0] == 0 && many[99] == 0);
+        auto node = new Node(42);
+        GLX_CHECK(node != nullptr && node->value == 42);
+        delete node;
+        mem::Arena arena;
+        auto placed = new (arena) Node(7);
+        GLX_CHECK(placed != nullptr && placed->value == 7);
+        placed->~Node();
+        // Bump the arena off a 64-byte boundary so the overload has to realign.
+        arena.allocate_bytes(8, 8);
+        auto wide = new (arena) WideNode(9);
+        GLX_CHECK(wide != nullptr && wide->value == 9);
+#if defined(__cpp_aligned_new)
+        GLX_CHECK(reinterpret_cast<uintptr_t>(wide) % 64 == 0);
+#endif
+        wide->~WideNode();
+    }
+}
+
+int main() {
+    for (usize length : { 1, 2, 7, 64, 1000, 100000 }) {
+        check_copies<uint64>(length);
+        check_copies<std::string>(length);
+    }
+    check_reallocate();
+    check_unique();
+    return test::result();
+}
@@ -0,0 +1,216 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Checks of the `mem::par` range functions against their serial `mem::` counterparts on ranges large enough to
+ * be split: disjoint and overlapping copies shifted either way by less and more than one wave, destinations off
+ * a cache line boundary, and non-trivial element types. CTest runs it with `GLX_THREADS` above 1, so the pool
+ * splits the work even on a single-CPU host. The page slices of `FirstTouch` are checked directly, since they are
+ * only used on hosts with several NUMA nodes.
+ * 
+ * @file parallel_test.cpp
+ * @date 2026-10-17
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "test_support.hpp"
+#include "../core/mem_parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace {
+    using namespace glx;
+
+    template <typename T>
+    T value_of(usize i) {
+        return T(uint64(i) * 0x9e3779b97f4a7c15ull >> 17);
+    }
+
+    template <typename T>
+    usize parallel_length() {
+        return mem::par::kParallelMinBytes / sizeof(T) + 1;
+    }
+
+    /// A buffer of `count` elements on a cache line boundary, filled with `value_of`.
+    template <typename T>
+    T* make_buffer(usize count) {
+        auto buffer = mem::allocate_aligned<T>(count, mem::kCacheLineBytes);
+        for (usize i = 0; i < count; i++) {
+            buffer[i] = value_of<T>(i);
+        }
+        return buffer;
+    }
+
+    /// Disjoint copies into destinations `offset` elements past a cache line boundary.
+    template <typename T>
+    void check_disjoint(usize offset) {
+        auto length = parallel_length<T>() * 3 + 17;
+        auto src    = make_buffer<T>(length);
+        auto dst    = mem::allocate_aligned<T>(offset + length, mem::kCacheLineBytes);
+        mem::fill_of_range(dst, 0, offset + length, T(0));
+        GLX_CHECK(mem::par::copy_of_range(dst, src, offset, 0, length) == StatusCode::Success);
+        GLX_CHECK(std::equal(src, src + length, dst + offset));
+        GLX_CHECK(offset == 0 || dst[offset - 1] == T(0));
+
+        auto model = mem::allocate_aligned<T>(offset + length, mem::kCacheLineBytes);
+        mem::fill_of_range(model, 0, offset + length, T(0));
+        mem::fill_of_range(model, offset, length, T(7));
+        GLX_CHECK(mem::par::fill_of_range(dst, offset, length, T(7)) == StatusCode::Success);
+        GLX_CHECK(std::equal(model, model + offset + length, dst));
+
+        auto raw = mem::allocate_aligned<T>(offset + length, mem::kCacheLineBytes);
+        GLX_CHECK(mem::par::uninitialized_copy_of_range(raw, src, offset, 0, length, mem::par::FirstTouch) == StatusCode::Success);
+        GLX_CHECK(std::equal(src, src + length, raw + offset));
+        GLX_CHECK(mem::par::uninitialized_fill_of_range(raw, offset, length, T(9), mem::par::FirstTouch) == StatusCode::Success);
+        GLX_CHECK(std::count(raw + offset, raw + offset + length, T(9)) == std::ptrdiff_t(length));
+        mem::deallocate(raw);
+        mem::deallocate(model);
+        mem::deallocate(dst);
+        mem::deallocate(src);
+    }
+
+    /// Copy `length` elements inside one array from `srcIndex` to `dstIndex` with both versions and compare.
+    template <typename T>
+    void check_overlapping(usize dstIndex, usize srcIndex, usize length) {
+        auto count  = (dstIndex > srcIndex ? dstIndex : srcIndex) + length;
+        auto serial = make_buffer<T>(count);
+        auto arr    = make_buffer<T>(count);
+        GLX_CHECK(mem::copy_of_range(serial, dstIndex, srcIndex, length) == StatusCode::Success);
+        GLX_CHECK(mem::par::copy_of_range(arr, dstIndex, srcIndex, length) == StatusCode::Success);
+        if (!GLX_CHECK(std::equal(serial, serial + count, arr))) {
+            std::fprintf(stderr, "  dst %zu, src %zu, length %zu\n", dstIndex, srcIndex, length);
+        }
+        mem::deallocate(arr);
+        mem::deallocate(serial);
+    }
+
+    /// Shifts of a range of several waves, each way: a small one the pool won't split, a wave that leaves less 
+    /// than one more behind, several waves with a partial last one, and no overlap at all. `offset` moves the
+    /// lower end off a cache line boundary.
+    template <typename T>
+    void check_overlapping_waves(usize offset) {
+        auto wave   = parallel_length<T>();
+        auto length = wave * 3 + 11;
+        for (usize distance : { usize(1000), length - wave / 2, wave + 5, length + 3 }) {
+            check_overlapping<T>(offset + distance, offset, length);
+            check_overlapping<T>(offset, offset + distance, length);
+        }
+    }
+
+    std::atomic<usize> destroyed{ 0 };
+
+    struct Tracked {
+        std::string text;
+
+        explicit Tracked(std::string text) : text(std::move(text)) {}
+        Tracked(Tracked const& other) : text(other.text) {}
+        ~Tracked() { destroyed.fetch_add(1, std::memory_order_relaxed); }
+    };
+
+    void check_non_trivial() {
+        std::string value(40, 'q');
+        auto length = parallel_length<std::string>() + 5;
+        auto raw    = mem::allocate_aligned<std::string>(length + 1, mem::kCacheLineBytes);
+        GLX_CHECK(mem::par::uninitialized_fill_of_range(raw, 1, length, value) == StatusCode::Success);
+        GLX_CHECK(std::count(raw + 1, raw + 1 + length, value) == std::ptrdiff_t(length));
+        mem::par::destruct_of_range(raw, 1, length);
+        GLX_CHECK(mem::par::uninitialized_fill_of_range(raw, 0, length, value, mem::par::FirstTouch) == StatusCode::Success);
+        GLX_CHECK(std::count(raw, raw + length, value) == std::ptrdiff_t(length));
+        mem::par::destruct_of_range(raw, 0, length);
+        mem::deallocate(raw);
+
+        // Every element is destructed exactly once.
+        auto tracked = mem::allocate_aligned<Tracked>(parallel_length<Tracked>() + 3, mem::kCacheLineBytes);
+        length = parallel_length<Tracked>() + 2;
+        GLX_CHECK(mem::par::uninitialized_fill_of_range(tracked, 1, length, Tracked(value)) == StatusCode::Success);
+        auto before = destroyed.load();
+        mem::par::destruct_of_range(tracked, 1, length);
+        GLX_CHECK(destroyed.load() - before == length);
+        mem::deallocate(tracked);
+    }
+
+    /// An element that does not divide the page, so slice boundaries can't fall exactly on page boundaries.
+    struct Triple {
+        uint64 raw[3];
+    };
+
+    /// Check the slices of `length` elements at address `start`.
+    template <typename T>
+    void check_slices(uintptr_t start, usize length, usize slices, usize page) {
+        mem::par::__ignore::SlicePlan<T> plan(reinterpret_cast<T const*>(start), length, slices, page);
+        auto pages = length == 0 ? 0 : (start + (length - 1) * sizeof(T)) / page - start / page + 1;
+        usize filled = 0;
+        bool  ok = plan.begin(0) == 0 && plan.end(slices - 1) == length;
+        for (usize slice = 0; slice < slices; slice++) {
+            auto begin = plan.begin(slice);
+            auto end   = plan.end(slice);
+            ok = ok && begin <= end && (slice + 1 == slices || end == plan.begin(slice + 1));
+            // Once a slice is empty, all the ones after it are.
+            ok = ok && (begin == end ? true : filled == slice);
+            filled += begin < end ? 1 : 0;
+            // An inner boundary is the first element starting on or after a page boundary.
+            if (begin != 0 && begin != length) {
+                ok = ok && (start + begin * sizeof(T)) / page != (start + (begin - 1) * sizeof(T)) / page;
+                ok = ok && (page % sizeof(T) != 0 || start % sizeof(T) != 0 || (start + begin * sizeof(T)) % page == 0);
+            }
+        }
+        ok = ok && filled == (pages < slices ? pages : slices);
+        if (!GLX_CHECK(ok)) {
+            std::fprintf(stderr, "  start %#zx, length %zu, slices %zu, page %zu\n", usize(start), length, slices, page);
+        }
+    }
+
+    template <typename T>
+    void check_slices() {
+        auto system = mem::__ignore::__page_bytes();
+        for (usize page : { usize(4096), system }) {
+            for (uintptr_t offset : { uintptr_t(0), uintptr_t(8), uintptr_t(24), uintptr_t(page - 8) }) {
+                auto start = uintptr_t(1) << 30 | offset;
+                for (usize slices = 1; slices <= 9; slices++) {
+                    auto perPage = page / sizeof(T);
+                    for (usize length : { usize(0), usize(1), usize(2), perPage - 1, perPage, perPage + 1, perPage * (slices - 1),
+                                          perPage * slices - 1, perPage * slices + 3, perPage * slices * 5 + 7, perPage * 100 + 1 }) {
+                        check_slices<T>(start, length, slices, page);
+                    }
+                }
+            }
+        }
+    }
+}
+
+int main() {
+    std::printf("threads: %zu\n", ThreadPool::global().concurrency());
+    for (usize offset : { 0, 1, 3, 8 }) {
+        check_disjoint<uint64>(offset);
+        check_overlapping_waves<uint64>(offset);
+    }
+    check_disjoint<byte>(7);
+    check_overlapping_waves<byte>(7);
+    check_non_trivial();
+    check_slices<uint64>();
+    check_slices<Triple>();
+    return test::result();
+}
@@ -0,0 +1,152 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Checks of `SpscRing` and `MpmcRing`: every record pushed is popped exactly once, in order within a producer,
+ * with single records and batches that wrap around the end of the slots.
+ * 
+ * @file ring_buffer_test.cpp
+ * @date 2026-10-17
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "test_support.hpp"
+#include "../core/ring_buffer.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+    using namespace glx;
+
+    constexpr usize  kRecords = 200000;    /// Records sent by each producer.
+    constexpr uint64 kShift   = 32;        /// A record is the producer id above `kShift` and the sequence below.
+
+    void check_spsc(usize batch) {
+        SpscRing<uint64> ring(64);
+        GLX_CHECK(ring.capacity() == 64);
+        std::thread producer([&] {
+            uint64 next = 0;
+            uint64 records[32];
+            while (next < kRecords) {
+                usize count = 0;
+                for (; count < batch && next + count < kRecords; count++) {
+                    records[count] = next + count;
+                }
+                auto pushed = ring.push_n(records, count);
+                next += pushed;
+                if (pushed == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        uint64 expected = 0;
+        auto   ordered  = true;
+        uint64 records[32];
+        while (expected < kRecords) {
+            auto count = ring.pop_n(records, batch);
+            for (usize i = 0; i < count; i++) {
+                ordered = ordered && records[i] == expected++;
+            }
+            if (count == 0) {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        GLX_CHECK(ordered);
+        GLX_CHECK(ring.size() == 0);
+    }
+
+    void check_mpmc(usize producers, usize consumers, usize batch) {
+        MpmcRing<uint64> ring(64);
+        std::vector<std::thread>         threads;
+        std::vector<std::atomic<uint64>> received(producers);
+        std::atomic<usize>               popped(0);
+        std::atomic<bool>                ordered(true);
+        for (auto& count : received) {
+            count.store(0);
+        }
+        for (usize p = 0; p < producers; p++) {
+            threads.emplace_back([&, p] {
+                uint64 next = 0;
+                uint64 records[32];
+                while (next < kRecords) {
+                    usize count = 0;
+                    for (; count < batch && next + count < kRecords; count++) {
+                        records[count] = (uint64(p) << kShift) | (next + count);
+                    }
+                    auto pushed = ring.push_n(records, count);
+                    next += pushed;
+                    if (pushed == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (usize c = 0; c < consumers; c++) {
+            threads.emplace_back([&] {
+                // Records of one producer reach one consumer in order, runs being published in claim order.
+                std::vector<uint64> last(producers, 0);
+                uint64 records[32];
+                while (popped.load() < producers * kRecords) {
+                    auto count = ring.pop_n(records, batch);
+                    for (usize i = 0; i < count; i++) {
+                        auto producer = usize(records[i] >> kShift);
+                        auto sequence = records[i] & ((uint64(1) << kShift) - 1);
+                        if (sequence + 1 <= last[producer]) {
+                            ordered.store(false);
+                        }
+                        last[producer] = sequence + 1;
+                        received[producer].fetch_add(1);
+                    }
+                    popped.fetch_add(count);
+                    if (count == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        auto complete = true;
+        for (auto& count : received) {
+            complete = complete && count.load() == kRecords;
+        }
+        GLX_CHECK(complete);
+        GLX_CHECK(ordered.load());
+        GLX_CHECK(ring.size() == 0);
+    }
+}
+
+int main() {
+    check_spsc(1);
+    check_spsc(7);
+    check_spsc(32);
+    check_mpmc(1, 1, 1);
+    check_mpmc(2, 2, 1);
+    check_mpmc(3, 2, 7);
+    check_mpmc(2, 3, 32);
+    return test::result();
+}
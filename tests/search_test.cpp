@@ -0,0 +1,112 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Checks of `mem::equal_of_range`, `compare_of_range`, `find_of_range` and `count_of_range` against the `std::`
+ * algorithms for 1 to 8 byte elements, lengths up to a few thousand and every element offset within a cache line.
+ * CTest runs it once per `GLX_SIMD` level.
+ * 
+ * @file search_test.cpp
+ * @date 2026-10-17
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "test_support.hpp"
+#include "../core/mem_utilities.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace {
+    using namespace glx;
+
+    constexpr usize kMaxLength = 2500;
+
+    /// Check every search of `arr[offset .. offset + length)` for `value`, and compare it with a copy whose
+    /// element `diff` is changed.
+    template <typename T>
+    bool check_range(std::vector<T>& arr, usize offset, usize length, T value, usize diff) {
+        auto first = arr.begin() + std::ptrdiff_t(offset);
+        auto last  = first + std::ptrdiff_t(length);
+        auto ok    = true;
+
+        usize position = 0;
+        mem::find_of_range(arr.data(), offset, length, value, position);
+        auto match = std::find(first, last, value);
+        ok = ok && position == (match == last ? mem::kNotFound : usize(match - arr.begin()));
+
+        usize count = 0;
+        mem::count_of_range(arr.data(), offset, length, value, count);
+        ok = ok && count == usize(std::count(first, last, value));
+
+        std::vector<T> copy(arr);
+        auto equal = false;
+        auto order = 2;
+        mem::equal_of_range(arr.data(), copy.data(), offset, offset, length, equal);
+        mem::compare_of_range(arr.data(), copy.data(), offset, offset, length, order);
+        ok = ok && equal && order == 0;
+        if (diff < length) {
+            copy[offset + diff] = T(copy[offset + diff] + 1);
+            mem::equal_of_range(arr.data(), copy.data(), offset, offset, length, equal);
+            mem::compare_of_range(arr.data(), copy.data(), offset, offset, length, order);
+            auto expected = std::lexicographical_compare(first, last, copy.begin() + std::ptrdiff_t(offset), copy.begin() + std::ptrdiff_t(offset + length)) ? -1 : 1;
+            ok = ok && !equal && order == expected;
+        }
+        return ok;
+    }
+
+    template <typename T>
+    void check_type() {
+        uint32 seed = 1;
+        std::vector<T> arr(kMaxLength + 64);
+        // Few distinct values, so matches are frequent; wider elements also get values sharing bytes with `value`.
+        for (auto& element : arr) {
+            seed    = seed * 1664525u + 1013904223u;
+            element = T((seed >> 16) % 64 == 0 ? 0x4142 : (seed >> 8) % 3 == 0 ? 0x4100 : (seed >> 4) & 0xff);
+        }
+        auto value = T(0x4142);
+        auto ok    = true;
+        for (usize length = 0; length <= kMaxLength && ok; length += length < 300 ? 1 : 37) {
+            for (usize offset = 0; offset < 64 / sizeof(T) && ok; offset++) {
+                auto diff = length == 0 ? 0 : (length * 7 + offset) % length;
+                ok = check_range(arr, offset, length, value, diff);
+                // No match at all, so the kernels run to the end.
+                ok = ok && check_range(arr, offset, length, T(0x7777), length / 2);
+                if (!ok) {
+                    std::fprintf(stderr, "  element %zu bytes, offset %zu, length %zu\n", sizeof(T), offset, length);
+                }
+            }
+        }
+        GLX_CHECK(ok);
+    }
+}
+
+int main() {
+    std::printf("simd level %d\n", int(cpu::simd_level()));
+    check_type<uint8>();
+    check_type<uint16>();
+    check_type<uint32>();
+    check_type<uint64>();
+    check_type<int32>();
+    return test::result();
+}
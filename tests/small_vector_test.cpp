@@ -0,0 +1,125 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Checks of `SmallVector`: up to its inline count it takes no heap block, counted by
+ * `small_vector_heap_allocations`, the first spill takes exactly one, and the elements survive every move
+ * between the inline storage and the heap.
+ * 
+ * @file small_vector_test.cpp
+ * @date 2026-10-17
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "test_support.hpp"
+#include "../core/small_vector.hpp"
+#include <string>
+
+namespace {
+    using namespace glx;
+
+    constexpr usize kInline = 8;
+
+    template <typename T>
+    T value_of(usize i);
+
+    template <>
+    int value_of<int>(usize i) {
+        return int(i * 7 + 1);
+    }
+
+    template <>
+    std::string value_of<std::string>(usize i) {
+        return std::string("element number ") + std::to_string(i);
+    }
+
+    template <typename T>
+    bool holds(SmallVector<T, kInline> const& vector, usize count) {
+        if (vector.size() != count) {
+            return false;
+        }
+        for (usize i = 0; i < count; i++) {
+            if (vector[i] != value_of<T>(i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename T>
+    void check_inline() {
+        auto before = small_vector_heap_allocations();
+        {
+            SmallVector<T, kInline> vector;
+            for (usize count = 0; count <= kInline; count++) {
+                GLX_CHECK(holds(vector, count));
+                GLX_CHECK(vector.is_inline());
+                if (count < kInline) {
+                    GLX_CHECK(vector.push_back(value_of<T>(count)) == StatusCode::Success);
+                }
+            }
+            GLX_CHECK(vector.erase(3) == StatusCode::Success);
+            GLX_CHECK(vector.insert(3, value_of<T>(3)) == StatusCode::Success);
+            SmallVector<T, kInline> moved(std::move(vector));
+            GLX_CHECK(moved.is_inline() && holds(moved, kInline));
+            moved.clear();
+            GLX_CHECK(moved.resize(kInline) == StatusCode::Success);
+            GLX_CHECK(moved.is_inline() && moved.size() == kInline);
+        }
+        GLX_CHECK(small_vector_heap_allocations() == before);
+    }
+
+    template <typename T>
+    void check_spill() {
+        SmallVector<T, kInline> vector;
+        for (usize i = 0; i < kInline; i++) {
+            vector.push_back(value_of<T>(i));
+        }
+        auto before = small_vector_heap_allocations();
+        GLX_CHECK(vector.push_back(value_of<T>(kInline)) == StatusCode::Success);
+        GLX_CHECK(small_vector_heap_allocations() == before + 1);
+        GLX_CHECK(!vector.is_inline() && holds(vector, kInline + 1));
+        for (usize i = kInline + 1; i < 1000; i++) {
+            vector.push_back(value_of<T>(i));
+        }
+        GLX_CHECK(holds(vector, 1000));
+        GLX_CHECK(vector.erase_range(kInline / 2, 1000 - kInline / 2) == StatusCode::Success);
+        GLX_CHECK(vector.shrink_to_fit() == StatusCode::Success);
+        GLX_CHECK(vector.is_inline() && holds(vector, kInline / 2));
+        SmallVector<T, kInline> other;
+        for (usize i = 0; i < 100; i++) {
+            other.push_back(value_of<T>(i));
+        }
+        vector.swap(other);
+        GLX_CHECK(holds(vector, 100) && holds(other, kInline / 2) && other.is_inline());
+    }
+}
+
+int main() {
+    check_inline<int>();
+    check_inline<std::string>();
+    check_spill<int>();
+    check_spill<std::string>();
+    return test::result();
+}
@@ -0,0 +1,167 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Checks of `mem::stats`: counts, bytes and live bytes of small and large blocks, blocks freed by another
+ * thread or after their thread exited, and tagged blocks.
+ * 
+ * @file stats_test.cpp
+ * @date 2026-10-17
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "test_support.hpp"
+#include "../core/mem_utilities.hpp"
+#include "../core/mem_stats.hpp"
+#include <thread>
+#include <vector>
+
+namespace {
+    using namespace glx;
+
+    constexpr usize kBlocks = 5000;   /// More than a few batches, so blocks go to and from the central cache.
+
+    /// The change of the counters of one bucket between two snapshots.
+    struct Delta {
+        uint64 allocations;
+        uint64 frees;
+    };
+
+    Delta delta(mem::AllocationStats const& before, mem::AllocationStats const& after, usize bucket) {
+        return Delta{ after.classes[bucket].allocations - before.classes[bucket].allocations,
+            after.classes[bucket].frees - before.classes[bucket].frees };
+    }
+
+    usize bucket_of(usize bytes) {
+        auto stats = mem::stats();
+        for (usize i = 0; i < mem::kStatsBucketCount; i++) {
+            if (stats.classes[i].blockBytes >= bytes) {
+                return i;
+            }
+        }
+        return mem::kStatsBucketCount;
+    }
+
+    void check_same_thread() {
+        auto bucket = bucket_of(100);
+        auto before = mem::stats();
+        std::vector<void*> blocks;
+        for (usize i = 0; i < kBlocks; i++) {
+            blocks.push_back(mem::allocate<byte>(100));
+        }
+        auto middle = mem::stats();
+        GLX_CHECK(delta(before, middle, bucket).allocations == kBlocks);
+        GLX_CHECK(delta(before, middle, bucket).frees == 0);
+        GLX_CHECK(middle.liveBytes - before.liveBytes == int64(kBlocks * middle.classes[bucket].blockBytes));
+        for (auto block : blocks) {
+            mem::deallocate(block);
+        }
+        auto after = mem::stats();
+        GLX_CHECK(delta(before, after, bucket).allocations == kBlocks);
+        GLX_CHECK(delta(before, after, bucket).frees == kBlocks);
+        GLX_CHECK(after.liveBytes == before.liveBytes);
+        // The peak is sampled when the thread goes to the central cache, so it may miss the last batch.
+        GLX_CHECK(after.peakBytes + int64(32 * middle.classes[bucket].blockBytes) >= middle.liveBytes);
+    }
+
+    void check_large() {
+        auto before = mem::stats();
+        auto block  = mem::allocate<byte>(100000);
+        auto middle = mem::stats();
+        mem::deallocate(block);
+        auto after = mem::stats();
+        GLX_CHECK(middle.allocations - before.allocations == 1);
+        GLX_CHECK(middle.allocatedBytes - before.allocatedBytes >= 100000);
+        GLX_CHECK(after.frees - before.frees == 1);
+        GLX_CHECK(after.liveBytes == before.liveBytes);
+    }
+
+    /// Blocks allocated here and freed by another thread go back to this thread; blocks allocated by a thread that
+    /// exits are freed here.
+    void check_other_threads() {
+        auto bucket = bucket_of(48);
+        auto before = mem::stats();
+        std::vector<void*> blocks;
+        for (usize i = 0; i < kBlocks; i++) {
+            blocks.push_back(mem::allocate<byte>(48));
+        }
+        std::thread consumer([&] {
+            for (auto block : blocks) {
+                mem::deallocate(block);
+            }
+        });
+        consumer.join();
+        blocks.clear();
+        std::thread producer([&] {
+            for (usize i = 0; i < kBlocks; i++) {
+                blocks.push_back(mem::allocate<byte>(48));
+            }
+        });
+        producer.join();
+        for (auto block : blocks) {
+            mem::deallocate(block);
+        }
+        // Reuse the blocks this thread got back, the ones freed remotely included.
+        for (usize i = 0; i < kBlocks; i++) {
+            blocks[i] = mem::allocate<byte>(48);
+        }
+        for (auto block : blocks) {
+            mem::deallocate(block);
+        }
+        auto after = mem::stats();
+        GLX_CHECK(delta(before, after, bucket).allocations == kBlocks * 3);
+        GLX_CHECK(delta(before, after, bucket).frees == kBlocks * 3);
+        GLX_CHECK(after.liveBytes == before.liveBytes);
+    }
+
+    void check_tags() {
+        auto tag    = mem::register_tag("stats_test");
+        auto before = mem::stats();
+        void* blocks[10];
+        {
+            mem::TagScope scope(tag);
+            for (auto& block : blocks) {
+                block = mem::allocate<byte>(64);
+            }
+        }
+        for (auto block : blocks) {
+            mem::deallocate(block);
+        }
+        auto after = mem::stats();
+        GLX_CHECK(tag != 0 && after.tagCount > tag);
+        GLX_CHECK(after.tags[tag].allocations - before.tags[tag].allocations == 10);
+        GLX_CHECK(after.tags[tag].frees - before.tags[tag].frees == 10);
+        GLX_CHECK(after.tags[0].allocations - before.tags[0].allocations == after.allocations - before.allocations - 10);
+    }
+}
+
+int main() {
+#if GLX_MEM_STATS
+    check_same_thread();
+    check_large();
+    check_other_threads();
+    check_tags();
+#endif
+    return test::result();
+}
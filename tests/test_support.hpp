@@ -0,0 +1,68 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * This file provides the checks shared by the tests under tests/. A failed check prints its location and is
+ * counted; `glx::test::result()` turns the count into the exit status CTest looks at.
+ * 
+ * @file test_support.hpp
+ * @date 2026-10-17
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#ifndef __GLX__TESTS__TEST__SUPPORT__HPP__
+#define __GLX__TESTS__TEST__SUPPORT__HPP__
+#include <cstdio>
+
+namespace glx {
+    namespace test {
+        /// The number of checks that failed so far.
+        inline int& failures() noexcept {
+            static int count = 0;
+            return count;
+        }
+
+        /// Record the check `cond`, printing `text` and its location when it does not hold.
+        inline bool check(bool cond, char const* text, char const* file, int line) noexcept {
+            if (!cond) {
+                std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, text);
+                failures()++;
+            }
+            return cond;
+        }
+
+        /// The exit status of a test: zero when every check held.
+        inline int result() noexcept {
+            if (failures() != 0) {
+                std::fprintf(stderr, "%d check(s) failed\n", failures());
+                return 1;
+            }
+            return 0;
+        }
+    }
+}
+
+#define GLX_CHECK(cond) ::glx::test::check(bool(cond), #cond, __FILE__, __LINE__)
+
+#endif
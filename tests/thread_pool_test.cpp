@@ -0,0 +1,130 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Checks of `ThreadPool`: every chunk of a loop runs exactly once, nested loops finish, `for_each_thread`
+ * from another thread runs each index once while nested loops are in flight, and a pool without memory for its
+ * queues runs loops inline. CTest gives it a timeout, so a
+ * deadlock fails the test.
+ * 
+ * @file thread_pool_test.cpp
+ * @date 2026-10-17
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "test_support.hpp"
+#include "../core/thread_pool.hpp"
+#include "../core/mem_budget.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+    using namespace glx;
+
+    void check_each_chunk_once(ThreadPool& pool) {
+        std::vector<std::atomic<int>> runs(1000);
+        for (auto& count : runs) {
+            count.store(0);
+        }
+        pool.parallel_for(runs.size(), [&](usize chunk) { runs[chunk].fetch_add(1); });
+        auto once = true;
+        for (auto& count : runs) {
+            once = once && count.load() == 1;
+        }
+        GLX_CHECK(once);
+    }
+
+    void check_nested(ThreadPool& pool) {
+        std::atomic<usize> inner(0);
+        pool.parallel_for(8, [&](usize) {
+            pool.parallel_for(16, [&](usize) { inner.fetch_add(1); });
+        });
+        GLX_CHECK(inner.load() == 8 * 16);
+    }
+
+    /// One thread runs nested loops while another calls `for_each_thread`, whose calls are pinned to the
+    /// workers busy with the outer loop.
+    void check_for_each_thread_with_nested_loops(ThreadPool& pool) {
+        constexpr usize kRounds = 200;
+        std::atomic<bool>  done(false);
+        std::atomic<usize> inner(0);
+        std::thread looper([&] {
+            for (usize round = 0; round < kRounds; round++) {
+                pool.parallel_for(2, [&](usize) {
+                    // Leave time for `for_each_thread` to queue its call before the inner chunks.
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                    pool.parallel_for(4, [&](usize) {
+                        inner.fetch_add(1);
+                        std::this_thread::yield();
+                    });
+                });
+            }
+            done.store(true);
+        });
+        usize calls = 0;
+        auto  wrong = false;
+        while (!done.load()) {
+            std::vector<std::atomic<int>> runs(pool.concurrency());
+            for (auto& count : runs) {
+                count.store(0);
+            }
+            pool.for_each_thread([&](usize thread) { runs[thread].fetch_add(1); });
+            for (auto& count : runs) {
+                wrong = wrong || count.load() != 1;
+            }
+            calls++;
+        }
+        looper.join();
+        GLX_CHECK(!wrong);
+        GLX_CHECK(calls > 0);
+        GLX_CHECK(inner.load() == kRounds * 2 * 4);
+    }
+
+    /// A pool whose queues can't be allocated runs every loop on the calling thread.
+    void check_out_of_memory() {
+        auto tag = mem::register_budget("thread_pool_test", 0, 0);
+        GLX_CHECK(tag != 0);
+        mem::TagScope scope(tag);
+        ThreadPool pool(4);
+        GLX_CHECK(pool.concurrency() == 1);
+        usize chunks = 0;
+        pool.parallel_for(10, [&](usize) { chunks++; });
+        pool.for_each_thread([&](usize) { chunks++; });
+        GLX_CHECK(chunks == 11);
+    }
+}
+
+int main() {
+    for (usize workers : { 0, 1, 2, 3 }) {
+        ThreadPool pool(workers);
+        GLX_CHECK(pool.concurrency() == workers + 1);
+        check_each_chunk_once(pool);
+        check_nested(pool);
+        check_for_each_thread_with_nested_loops(pool);
+    }
+    check_out_of_memory();
+    return test::result();
+}
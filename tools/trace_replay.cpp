@@ -0,0 +1,353 @@
+/*
+ * MIT License
+ * Copyright (c) 2021 ZhangKeyangZzz
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * Replays a trace written by `mem::start_trace` against `new[]`, the pool behind `mem::allocate` and a per-thread
+ * `mem::Arena`, and reports throughput, latency percentiles, peak RSS and fragmentation for each.
+ * Usage: trace_replay <trace-file>
+ * 
+ * Every recorded thread is replayed by a thread of its own, in the recorded order. A thread freeing a block that
+ * another thread allocated waits until that allocation was replayed. Every page of a block is written once, so
+ * the RSS is what the workload would touch. Each backend runs in a child process so that memory cached by one
+ * doesn't count against the next. Fragmentation is `1 - peak live bytes / peak RSS growth`; the arena never frees,
+ * which shows what reuse saves. A backend that runs out of memory stops its replay and is reported as such.
+ * 
+ * @file trace_replay.cpp
+ * @date 2026-10-16
+ * @author ZhangKeyangZzz
+ * @version 1.0 Release
+ */
+
+#include "../core/mem_arena.hpp"
+#include "../core/mem_trace.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+    using namespace glx;
+
+    constexpr usize kPageBytes = 4096;
+
+    /// One replayed call. A free names the slot of its allocation; frees without a traced allocation are dropped.
+    struct Op {
+        uint64 bytes;
+        uint32 slot;
+        uint32 kind;
+    };
+
+    struct Workload {
+        std::vector<std::vector<Op>> threads;
+        std::vector<uint64>          slotBytes;
+        uint64                       records  = 0;
+        uint64                       peakLive = 0;
+    };
+
+    struct Result {
+        int    status;
+        double mops;
+        uint64 p50, p99, p999, max;
+        uint64 rssBytes;
+    };
+
+    struct HeapBackend {
+        void* allocate(usize bytes) { return new (std::nothrow) byte[bytes]; }
+        void deallocate(void* ptr, usize) { delete[] reinterpret_cast<byte*>(ptr); }
+    };
+
+    struct PoolBackend {
+        void* allocate(usize bytes) { return mem::allocate<byte>(bytes); }
+        void deallocate(void* ptr, usize bytes) { mem::deallocate(ptr, bytes); }
+    };
+
+    struct ArenaBackend {
+        mem::Arena arena;
+        void* allocate(usize bytes) { return arena.allocate_bytes(bytes); }
+        void deallocate(void*, usize) {}
+    };
+
+    bool load(const char* path, Workload& workload) {
+        auto file = std::fopen(path, "rb");
+        if (file == nullptr) {
+            std::fprintf(stderr, "trace_replay: can't open %s\n", path);
+            return false;
+        }
+        mem::TraceFileHeader header;
+        if (std::fread(&header, sizeof(header), 1, file) != 1 || std::memcmp(header.magic, "GLXTRACE", 8) != 0 ||
+            header.version != mem::kTraceVersion || header.recordBytes != sizeof(mem::TraceRecord)) {
+            std::fprintf(stderr, "trace_replay: %s is not a trace of this version\n", path);
+            std::fclose(file);
+            return false;
+        }
+        std::vector<mem::TraceRecord> records;
+        mem::TraceRecord chunk[4096];
+        usize count;
+        while ((count = std::fread(chunk, sizeof(mem::TraceRecord), 4096, file)) > 0) {
+            records.insert(records.end(), chunk, chunk + count);
+        }
+        std::fclose(file);
+        std::stable_sort(records.begin(), records.end(), [](mem::TraceRecord const& a, mem::TraceRecord const& b) {
+            return a.time < b.time;
+        });
+
+        std::unordered_map<uint32, usize>  threadIndex;
+        std::unordered_map<uint64, uint32> liveSlots;
+        uint64 live = 0;
+        for (auto const& record : records) {
+            auto found = threadIndex.find(record.thread);
+            if (found == threadIndex.end()) {
+                found = threadIndex.emplace(record.thread, workload.threads.size()).first;
+                workload.threads.emplace_back();
+            }
+            auto& ops = workload.threads[found->second];
+            if (record.kind == mem::kTraceAllocate) {
+                auto slot = uint32(workload.slotBytes.size());
+                workload.slotBytes.push_back(record.bytes);
+                liveSlots[record.address] = slot;
+                ops.push_back(Op{ record.bytes, slot, mem::kTraceAllocate });
+                live += record.bytes;
+                workload.peakLive = std::max(workload.peakLive, live);
+            } else {
+                auto slot = liveSlots.find(record.address);
+                if (slot == liveSlots.end()) {
+                    continue;
+                }
+                ops.push_back(Op{ workload.slotBytes[slot->second], slot->second, mem::kTraceFree });
+                live -= workload.slotBytes[slot->second];
+                liveSlots.erase(slot);
+            }
+        }
+        workload.records = records.size();
+        return true;
+    }
+
+    /// Read a field in kB of /proc/self/status, in bytes.
+    uint64 status_bytes(const char* field) {
+        auto file = std::fopen("/proc/self/status", "r");
+        if (file == nullptr) {
+            return 0;
+        }
+        char line[256];
+        uint64 value = 0;
+        auto length = std::strlen(field);
+        while (std::fgets(line, sizeof(line), file) != nullptr) {
+            if (std::strncmp(line, field, length) == 0) {
+                value = std::strtoull(line + length + 1, nullptr, 10) * 1024;
+                break;
+            }
+        }
+        std::fclose(file);
+        return value;
+    }
+
+    /// Reset the peak RSS of this process to its current RSS.
+    void reset_peak_rss() {
+        auto file = std::fopen("/proc/self/clear_refs", "w");
+        if (file != nullptr) {
+            std::fputs("5", file);
+            std::fclose(file);
+        }
+    }
+
+    inline uint64 now_ns() {
+        auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return uint64(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+    }
+
+    /// Replay the calls of one thread; with `latencies` set, time every call on its own. A failed allocation sets
+    /// `outOfMemory` and ends the thread, and threads waiting to free a block that will never come end too.
+    template <typename Backend>
+    void replay(std::vector<Op> const& ops, std::atomic<void*>* slots, std::vector<uint32>* latencies, std::atomic<bool>& outOfMemory) {
+        Backend backend;
+        for (auto const& op : ops) {
+            if (op.kind == mem::kTraceAllocate) {
+                auto start = latencies != nullptr ? now_ns() : 0;
+                auto ptr   = reinterpret_cast<byte*>(backend.allocate(usize(op.bytes)));
+                if (latencies != nullptr) {
+                    latencies->push_back(uint32(std::min<uint64>(now_ns() - start, uint32(-1))));
+                }
+                if (ptr == nullptr) {
+                    outOfMemory.store(true, std::memory_order_release);
+                    return;
+                }
+                for (uint64 offset = 0; offset < op.bytes; offset += kPageBytes) {
+                    ptr[offset] = byte(1);
+                }
+                slots[op.slot].store(ptr, std::memory_order_release);
+            } else {
+                void* ptr;
+                while ((ptr = slots[op.slot].load(std::memory_order_acquire)) == nullptr) {
+                    if (outOfMemory.load(std::memory_order_acquire)) {
+                        return;
+                    }
+                    std::this_thread::yield();
+                }
+                auto start = latencies != nullptr ? now_ns() : 0;
+                backend.deallocate(ptr, usize(op.bytes));
+                if (latencies != nullptr) {
+                    latencies->push_back(uint32(std::min<uint64>(now_ns() - start, uint32(-1))));
+                }
+            }
+        }
+    }
+
+    template <typename Backend>
+    double run(Workload const& workload, std::vector<std::atomic<void*>>& slots, std::vector<std::vector<uint32>>* latencies,
+               std::atomic<bool>& outOfMemory) {
+        for (auto& slot : slots) {
+            slot.store(nullptr, std::memory_order_relaxed);
+        }
+        std::vector<std::thread> workers;
+        auto start = std::chrono::steady_clock::now();
+        for (usize i = 0; i < workload.threads.size(); i++) {
+            auto perThread = latencies != nullptr ? &(*latencies)[i] : nullptr;
+            workers.emplace_back(replay<Backend>, std::cref(workload.threads[i]), slots.data(), perThread, std::ref(outOfMemory));
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        usize ops = 0;
+        for (auto const& thread : workload.threads) {
+            ops += thread.size();
+        }
+        return double(ops) / elapsed.count() / 1e6;
+    }
+
+    /// A timed pass with the peak RSS, then a pass timing every call. Everything the replay itself needs is
+    /// allocated before the RSS baseline. Either pass running out of memory ends the measurement.
+    template <typename Backend>
+    Result measure(Workload const& workload) {
+        Result result = {};
+        std::atomic<bool> outOfMemory{ false };
+        std::vector<std::atomic<void*>>  slots(workload.slotBytes.size());
+        std::vector<std::vector<uint32>> latencies(workload.threads.size());
+        for (usize i = 0; i < latencies.size(); i++) {
+            latencies[i].reserve(workload.threads[i].size());
+        }
+        reset_peak_rss();
+        auto baseline = status_bytes("VmRSS:");
+        result.mops     = run<Backend>(workload, slots, nullptr, outOfMemory);
+        auto peak       = status_bytes("VmHWM:");
+        result.rssBytes = peak > baseline ? peak - baseline : 0;
+        if (outOfMemory.load()) {
+            result.status = StatusCode::OutOfMemory;
+            return result;
+        }
+
+        run<Backend>(workload, slots, &latencies, outOfMemory);
+        if (outOfMemory.load()) {
+            result.status = StatusCode::OutOfMemory;
+            return result;
+        }
+        std::vector<uint32> all;
+        for (auto const& perThread : latencies) {
+            all.insert(all.end(), perThread.begin(), perThread.end());
+        }
+        if (!all.empty()) {
+            auto percentile = [&](double p) {
+                auto at = all.begin() + std::ptrdiff_t(double(all.size() - 1) * p);
+                std::nth_element(all.begin(), at, all.end());
+                return uint64(*at);
+            };
+            result.p50  = percentile(0.5);
+            result.p99  = percentile(0.99);
+            result.p999 = percentile(0.999);
+            result.max  = *std::max_element(all.begin(), all.end());
+        }
+        return result;
+    }
+
+    template <typename Backend>
+    bool measure_in_child(Workload const& workload, Result& result) {
+        int pipes[2];
+        if (::pipe(pipes) != 0) {
+            return false;
+        }
+        auto child = ::fork();
+        if (child < 0) {
+            return false;
+        }
+        if (child == 0) {
+            ::close(pipes[0]);
+            auto measured = measure<Backend>(workload);
+            auto written  = ::write(pipes[1], &measured, sizeof(measured));
+            ::_exit(written == ssize_t(sizeof(measured)) ? 0 : 1);
+        }
+        ::close(pipes[1]);
+        auto ok = ::read(pipes[0], &result, sizeof(result)) == ssize_t(sizeof(result));
+        ::close(pipes[0]);
+        int status = 0;
+        ::waitpid(child, &status, 0);
+        return ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+
+    template <typename Backend>
+    void report(const char* name, Workload const& workload) {
+        Result result;
+        if (!measure_in_child<Backend>(workload, result)) {
+            std::printf("%8s %10s\n", name, "failed");
+            return;
+        }
+        if (result.status == StatusCode::OutOfMemory) {
+            std::printf("%8s %10s\n", name, "out of memory");
+            return;
+        }
+        auto fragmentation = result.rssBytes > workload.peakLive ? 1.0 - double(workload.peakLive) / double(result.rssBytes) : 0.0;
+        std::printf("%8s %10.2f %8llu %8llu %8llu %10llu %12.2f %8.1f%%\n", name, result.mops,
+            (unsigned long long)result.p50, (unsigned long long)result.p99, (unsigned long long)result.p999,
+            (unsigned long long)result.max, double(result.rssBytes) / 1048576.0, fragmentation * 100.0);
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: trace_replay <trace-file>\n");
+        return 2;
+    }
+    Workload workload;
+    if (!load(argv[1], workload)) {
+        return 1;
+    }
+    usize ops = 0;
+    for (auto const& thread : workload.threads) {
+        ops += thread.size();
+    }
+    std::printf("%llu records, %zu replayed calls, %zu threads, peak live %.2f MB\n",
+        (unsigned long long)workload.records, ops, workload.threads.size(), double(workload.peakLive) / 1048576.0);
+    std::printf("%8s %10s %8s %8s %8s %10s %12s %9s\n", "backend", "Mops/s", "p50 ns", "p99 ns", "p99.9 ns", "max ns",
+        "peak RSS MB", "frag");
+    std::fflush(stdout);
+    report<HeapBackend>("new[]", workload);
+    report<PoolBackend>("pool", workload);
+    report<ArenaBackend>("arena", workload);
+    return 0;
+}